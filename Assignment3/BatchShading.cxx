@@ -0,0 +1,310 @@
+#include "assignmentSpecific/BatchShading.h"
+
+#include <cmath>
+
+#include "glUtility/Vertex.h"
+#include "math/Vector.h"
+#include "math/VectorLanes.h"
+
+namespace
+{
+	const float AMBIENT_LIGHT = 0.4;
+	const float DIFFUSE_REFLECTIVITY = 0.4;
+	const float SPECULAR_REFLECTIVITY = 0.2;
+
+	const int LANES = 4;
+
+	//Scalar versions of the kernels, for the hits and samples left over after the last full group of lanes. The
+	//vector kernels perform the same operations in the same order.
+	void directionToEyeOfHit(
+		int i,
+		float eyeX, float eyeY, float eyeZ,
+		const float* pointX, const float* pointY, const float* pointZ,
+		float* toEyeX, float* toEyeY, float* toEyeZ)
+	{
+		const float x = eyeX - pointX[i];
+		const float y = eyeY - pointY[i];
+		const float z = eyeZ - pointZ[i];
+		const float inverseLength = 1 / std::sqrt(x * x + y * y + z * z);
+		toEyeX[i] = x * inverseLength;
+		toEyeY[i] = y * inverseLength;
+		toEyeZ[i] = z * inverseLength;
+	}
+
+	void directionToLightAndDiffuseLightOfSample(
+		int i,
+		const float* pointX, const float* pointY, const float* pointZ,
+		const float* normalX, const float* normalY, const float* normalZ,
+		const float* lightX, const float* lightY, const float* lightZ,
+		float* toLightX, float* toLightY, float* toLightZ,
+		float* normalDotLight, float* diffuseLight)
+	{
+		const float x = lightX[i] - pointX[i];
+		const float y = lightY[i] - pointY[i];
+		const float z = lightZ[i] - pointZ[i];
+		const float inverseLength = 1 / std::sqrt(x * x + y * y + z * z);
+		toLightX[i] = x * inverseLength;
+		toLightY[i] = y * inverseLength;
+		toLightZ[i] = z * inverseLength;
+
+		normalDotLight[i] = normalX[i] * toLightX[i] + normalY[i] * toLightY[i] + normalZ[i] * toLightZ[i];
+		diffuseLight[i] = DIFFUSE_REFLECTIVITY * normalDotLight[i];
+	}
+
+	void directLightOfSample(
+		int i,
+		const float* normalX, const float* normalY, const float* normalZ,
+		const float* toLightX, const float* toLightY, const float* toLightZ,
+		const float* toEyeX, const float* toEyeY, const float* toEyeZ,
+		const float* normalDotLight, const float* diffuseLight, const float* lightVisibility, const float* lightScale,
+		float* directLight)
+	{
+		//The reflected light is 2(N.L)(N - L), so its dot product with the direction to the eye is 2(N.L)(N.E - L.E)
+		const float normalDotEye = normalX[i] * toEyeX[i] + normalY[i] * toEyeY[i] + normalZ[i] * toEyeZ[i];
+		const float lightDotEye = toLightX[i] * toEyeX[i] + toLightY[i] * toEyeY[i] + toLightZ[i] * toEyeZ[i];
+		const float reflectedLightDotEye = 2 * normalDotLight[i] * (normalDotEye - lightDotEye);
+		const float specularLight = SPECULAR_REFLECTIVITY * reflectedLightDotEye * reflectedLightDotEye;
+
+		directLight[i] = lightVisibility[i] * (lightScale[i] * (diffuseLight[i] + specularLight));
+	}
+
+	MathTypes::VectorLanes::Lanes dotProductOfLanes(
+		MathTypes::VectorLanes::Lanes ax, MathTypes::VectorLanes::Lanes ay, MathTypes::VectorLanes::Lanes az,
+		MathTypes::VectorLanes::Lanes bx, MathTypes::VectorLanes::Lanes by, MathTypes::VectorLanes::Lanes bz)
+	{
+		using namespace MathTypes::VectorLanes;
+		return sum(sum(product(ax, bx), product(ay, by)), product(az, bz));
+	}
+}
+
+void RayTracing::ShadingBatch::clear()
+{
+	for(auto* component : {&pointX_, &pointY_, &pointZ_, &normalX_, &normalY_, &normalZ_, &red_, &green_, &blue_,
+		&samplePointX_, &samplePointY_, &samplePointZ_, &sampleNormalX_, &sampleNormalY_, &sampleNormalZ_,
+		&lightX_, &lightY_, &lightZ_, &lightScale_})
+	{
+		component->clear();
+	}
+	hitOfSample_.clear();
+}
+
+int RayTracing::ShadingBatch::numberOfHits() const
+{
+	return pointX_.size();
+}
+
+int RayTracing::ShadingBatch::numberOfLightSamples() const
+{
+	return hitOfSample_.size();
+}
+
+int RayTracing::ShadingBatch::addHit(
+	const MathTypes::Vector<3, float>& point,
+	const MathTypes::Vector<3, float>& surfaceNormal,
+	const GLUtility::Colour<float>& colour)
+{
+	pointX_.push_back(point.xValue());
+	pointY_.push_back(point.yValue());
+	pointZ_.push_back(point.zValue());
+	normalX_.push_back(surfaceNormal.xValue());
+	normalY_.push_back(surfaceNormal.yValue());
+	normalZ_.push_back(surfaceNormal.zValue());
+	red_.push_back(colour.red);
+	green_.push_back(colour.green);
+	blue_.push_back(colour.blue);
+	return numberOfHits() - 1;
+}
+
+int RayTracing::ShadingBatch::addLightSample(int hit, const MathTypes::Vector<3, float>& lightPosition, float lightScale)
+{
+	hitOfSample_.push_back(hit);
+	samplePointX_.push_back(pointX_[hit]);
+	samplePointY_.push_back(pointY_[hit]);
+	samplePointZ_.push_back(pointZ_[hit]);
+	sampleNormalX_.push_back(normalX_[hit]);
+	sampleNormalY_.push_back(normalY_[hit]);
+	sampleNormalZ_.push_back(normalZ_[hit]);
+	lightX_.push_back(lightPosition.xValue());
+	lightY_.push_back(lightPosition.yValue());
+	lightZ_.push_back(lightPosition.zValue());
+	lightScale_.push_back(lightScale);
+	return numberOfLightSamples() - 1;
+}
+
+void RayTracing::ShadingBatch::calculateDirectionsAndDiffuseLight(const MathTypes::Vector<3, float>& eyePosition)
+{
+	using namespace MathTypes::VectorLanes;
+	const int hits = numberOfHits();
+	for(auto* component : {&toEyeX_, &toEyeY_, &toEyeZ_})
+	{
+		component->resize(hits);
+	}
+
+	int i = 0;
+	const Lanes eyeX = broadcast(eyePosition.xValue());
+	const Lanes eyeY = broadcast(eyePosition.yValue());
+	const Lanes eyeZ = broadcast(eyePosition.zValue());
+	const Lanes one = broadcast(1);
+	for(; i + LANES <= hits; i += LANES)
+	{
+		const Lanes x = difference(eyeX, fromArray(&pointX_[i]));
+		const Lanes y = difference(eyeY, fromArray(&pointY_[i]));
+		const Lanes z = difference(eyeZ, fromArray(&pointZ_[i]));
+		const Lanes inverseLength = quotient(one, squareRoot(dotProductOfLanes(x, y, z, x, y, z)));
+		toArray(product(x, inverseLength), &toEyeX_[i]);
+		toArray(product(y, inverseLength), &toEyeY_[i]);
+		toArray(product(z, inverseLength), &toEyeZ_[i]);
+	}
+	for(; i < hits; i++)
+	{
+		directionToEyeOfHit(i,
+			eyePosition.xValue(), eyePosition.yValue(), eyePosition.zValue(),
+			pointX_.data(), pointY_.data(), pointZ_.data(),
+			toEyeX_.data(), toEyeY_.data(), toEyeZ_.data());
+	}
+
+	const int samples = numberOfLightSamples();
+	for(auto* component : {&sampleToEyeX_, &sampleToEyeY_, &sampleToEyeZ_,
+		&toLightX_, &toLightY_, &toLightZ_, &normalDotLight_, &diffuseLight_})
+	{
+		component->resize(samples);
+	}
+	lightVisibility_.assign(samples, 1);
+	for(int sample = 0; sample < samples; sample++)
+	{
+		sampleToEyeX_[sample] = toEyeX_[hitOfSample_[sample]];
+		sampleToEyeY_[sample] = toEyeY_[hitOfSample_[sample]];
+		sampleToEyeZ_[sample] = toEyeZ_[hitOfSample_[sample]];
+	}
+
+	i = 0;
+	const Lanes diffuseReflectivity = broadcast(DIFFUSE_REFLECTIVITY);
+	for(; i + LANES <= samples; i += LANES)
+	{
+		const Lanes x = difference(fromArray(&lightX_[i]), fromArray(&samplePointX_[i]));
+		const Lanes y = difference(fromArray(&lightY_[i]), fromArray(&samplePointY_[i]));
+		const Lanes z = difference(fromArray(&lightZ_[i]), fromArray(&samplePointZ_[i]));
+		const Lanes inverseLength = quotient(one, squareRoot(dotProductOfLanes(x, y, z, x, y, z)));
+		const Lanes toLightX = product(x, inverseLength);
+		const Lanes toLightY = product(y, inverseLength);
+		const Lanes toLightZ = product(z, inverseLength);
+
+		const Lanes normalDotLight = dotProductOfLanes(
+			fromArray(&sampleNormalX_[i]), fromArray(&sampleNormalY_[i]), fromArray(&sampleNormalZ_[i]),
+			toLightX, toLightY, toLightZ);
+
+		toArray(toLightX, &toLightX_[i]);
+		toArray(toLightY, &toLightY_[i]);
+		toArray(toLightZ, &toLightZ_[i]);
+		toArray(normalDotLight, &normalDotLight_[i]);
+		toArray(product(diffuseReflectivity, normalDotLight), &diffuseLight_[i]);
+	}
+	for(; i < samples; i++)
+	{
+		directionToLightAndDiffuseLightOfSample(i,
+			samplePointX_.data(), samplePointY_.data(), samplePointZ_.data(),
+			sampleNormalX_.data(), sampleNormalY_.data(), sampleNormalZ_.data(),
+			lightX_.data(), lightY_.data(), lightZ_.data(),
+			toLightX_.data(), toLightY_.data(), toLightZ_.data(),
+			normalDotLight_.data(), diffuseLight_.data());
+	}
+}
+
+void RayTracing::ShadingBatch::shade()
+{
+	using namespace MathTypes::VectorLanes;
+	const int samples = numberOfLightSamples();
+	directLight_.resize(samples);
+
+	int i = 0;
+	const Lanes two = broadcast(2);
+	const Lanes specularReflectivity = broadcast(SPECULAR_REFLECTIVITY);
+	for(; i + LANES <= samples; i += LANES)
+	{
+		const Lanes normalX = fromArray(&sampleNormalX_[i]);
+		const Lanes normalY = fromArray(&sampleNormalY_[i]);
+		const Lanes normalZ = fromArray(&sampleNormalZ_[i]);
+		const Lanes toEyeX = fromArray(&sampleToEyeX_[i]);
+		const Lanes toEyeY = fromArray(&sampleToEyeY_[i]);
+		const Lanes toEyeZ = fromArray(&sampleToEyeZ_[i]);
+
+		const Lanes normalDotEye = dotProductOfLanes(normalX, normalY, normalZ, toEyeX, toEyeY, toEyeZ);
+		const Lanes lightDotEye = dotProductOfLanes(
+			fromArray(&toLightX_[i]), fromArray(&toLightY_[i]), fromArray(&toLightZ_[i]), toEyeX, toEyeY, toEyeZ);
+		const Lanes reflectedLightDotEye = product(
+			product(two, fromArray(&normalDotLight_[i])), difference(normalDotEye, lightDotEye));
+		const Lanes specularLight = product(product(specularReflectivity, reflectedLightDotEye), reflectedLightDotEye);
+
+		toArray(product(fromArray(&lightVisibility_[i]), product(
+			fromArray(&lightScale_[i]), sum(fromArray(&diffuseLight_[i]), specularLight))), &directLight_[i]);
+	}
+	for(; i < samples; i++)
+	{
+		directLightOfSample(i,
+			sampleNormalX_.data(), sampleNormalY_.data(), sampleNormalZ_.data(),
+			toLightX_.data(), toLightY_.data(), toLightZ_.data(),
+			sampleToEyeX_.data(), sampleToEyeY_.data(), sampleToEyeZ_.data(),
+			normalDotLight_.data(), diffuseLight_.data(), lightVisibility_.data(), lightScale_.data(),
+			directLight_.data());
+	}
+
+	//Samples are added to their hit in the order they were added to the batch, which keeps the sums, and so the
+	//images, the same from run to run
+	const int hits = numberOfHits();
+	totalLight_.assign(hits, AMBIENT_LIGHT);
+	for(int sample = 0; sample < samples; sample++)
+	{
+		totalLight_[hitOfSample_[sample]] += directLight_[sample];
+	}
+	for(int hit = 0; hit < hits; hit++)
+	{
+		red_[hit] = red_[hit] * totalLight_[hit];
+		green_[hit] = green_[hit] * totalLight_[hit];
+		blue_[hit] = blue_[hit] * totalLight_[hit];
+	}
+}
+
+MathTypes::Vector<3, float> RayTracing::ShadingBatch::point(int hit) const
+{
+	return MathTypes::Vector<3, float>(pointX_[hit], pointY_[hit], pointZ_[hit]);
+}
+
+MathTypes::Vector<3, float> RayTracing::ShadingBatch::surfaceNormal(int hit) const
+{
+	return MathTypes::Vector<3, float>(normalX_[hit], normalY_[hit], normalZ_[hit]);
+}
+
+MathTypes::Vector<3, float> RayTracing::ShadingBatch::pointToEye(int hit) const
+{
+	return MathTypes::Vector<3, float>(toEyeX_[hit], toEyeY_[hit], toEyeZ_[hit]);
+}
+
+int RayTracing::ShadingBatch::hitOfLightSample(int sample) const
+{
+	return hitOfSample_[sample];
+}
+
+MathTypes::Vector<3, float> RayTracing::ShadingBatch::pointToLight(int sample) const
+{
+	return MathTypes::Vector<3, float>(toLightX_[sample], toLightY_[sample], toLightZ_[sample]);
+}
+
+float RayTracing::ShadingBatch::diffuseLight(int sample) const
+{
+	return diffuseLight_[sample];
+}
+
+void RayTracing::ShadingBatch::setDiffuseLight(int sample, float diffuseLight)
+{
+	diffuseLight_[sample] = diffuseLight;
+}
+
+void RayTracing::ShadingBatch::setPointIsLit(int sample, bool pointIsLit)
+{
+	lightVisibility_[sample] = pointIsLit ? 1 : 0;
+}
+
+GLUtility::Colour<float> RayTracing::ShadingBatch::shadedColour(int hit) const
+{
+	return GLUtility::Colour<float>(red_[hit], green_[hit], blue_[hit]);
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <vector>
+
+namespace GLUtility
+{
+	template<typename ColourPrimitive> struct Colour;
+}
+
+namespace MathTypes
+{
+	template<int dimensions, typename CoordinatePrimitive> class Vector;
+}
+
+namespace RayTracing
+{
+	//Hits that are waiting to be shaded, stored one array per component so that the lighting of several hits
+	//is calculated per instruction. Each hit is lit by any number of light samples, one for each light that
+	//reaches it, which are stored the same way. Shading happens in two stages so that the caller can decide,
+	//between them, which samples are in shadow:
+	//	1. calculateDirectionsAndDiffuseLight() finds the direction to the eye of every hit, and the direction to
+	//	   the light and the diffuse term of every light sample
+	//	2. shade() adds the specular term, sums the light of the samples of each hit along with the ambient light,
+	//	   and applies it to the colour of the hit
+	class ShadingBatch
+	{
+	public:
+		ShadingBatch() = default;
+		~ShadingBatch() = default;
+
+		void clear();
+		int numberOfHits() const;
+		int numberOfLightSamples() const;
+		//Returns the index of the hit within the batch
+		int addHit(
+			const MathTypes::Vector<3, float>& point,
+			const MathTypes::Vector<3, float>& surfaceNormal,
+			const GLUtility::Colour<float>& colour);
+		//Lights the hit with a light at lightPosition, whose diffuse and specular light are multiplied by
+		//lightScale, e.g. for falloff. Returns the index of the sample within the batch.
+		int addLightSample(int hit, const MathTypes::Vector<3, float>& lightPosition, float lightScale);
+
+		void calculateDirectionsAndDiffuseLight(const MathTypes::Vector<3, float>& eyePosition);
+		void shade();
+
+		MathTypes::Vector<3, float> point(int hit) const;
+		MathTypes::Vector<3, float> surfaceNormal(int hit) const;
+		MathTypes::Vector<3, float> pointToEye(int hit) const;
+
+		int hitOfLightSample(int sample) const;
+		MathTypes::Vector<3, float> pointToLight(int sample) const;
+		//Valid after calculateDirectionsAndDiffuseLight(). Can be overridden before shade(), e.g. by cached lighting.
+		float diffuseLight(int sample) const;
+		void setDiffuseLight(int sample, float diffuseLight);
+		//Samples are lit by default. A shadowed sample adds no light to its hit.
+		void setPointIsLit(int sample, bool pointIsLit);
+
+		//Valid after shade()
+		GLUtility::Colour<float> shadedColour(int hit) const;
+
+	private:
+		std::vector<float> pointX_, pointY_, pointZ_;
+		std::vector<float> normalX_, normalY_, normalZ_;
+		std::vector<float> red_, green_, blue_;
+		std::vector<float> toEyeX_, toEyeY_, toEyeZ_;
+		std::vector<float> totalLight_;
+
+		//Light samples carry copies of the point, normal and eye direction of their hit, so that they can be
+		//loaded into SIMD lanes as easily as the hits themselves
+		std::vector<int> hitOfSample_;
+		std::vector<float> samplePointX_, samplePointY_, samplePointZ_;
+		std::vector<float> sampleNormalX_, sampleNormalY_, sampleNormalZ_;
+		std::vector<float> sampleToEyeX_, sampleToEyeY_, sampleToEyeZ_;
+		std::vector<float> lightX_, lightY_, lightZ_;
+		std::vector<float> lightScale_;
+		std::vector<float> toLightX_, toLightY_, toLightZ_;
+		std::vector<float> normalDotLight_;
+		std::vector<float> diffuseLight_;
+		//1 where the light reaches the hit, 0 where it is in shadow
+		std::vector<float> lightVisibility_;
+		std::vector<float> directLight_;
+	};
+}
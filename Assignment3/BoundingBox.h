@@ -0,0 +1,154 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+
+#include "assignmentSpecific/Ray.h"
+#include "math/Vector.h"
+
+namespace RayTracing
+{
+	//Axis aligned box used to bound objects of a scene.
+	class BoundingBox
+	{
+	public:
+		BoundingBox(const MathTypes::Vector<3, float>& minimumCorner, const MathTypes::Vector<3, float>& maximumCorner);
+		~BoundingBox() = default;
+
+		//A box that contains nothing. Enclosing it with any other box yields the other box.
+		static BoundingBox emptyBox();
+
+		MathTypes::Vector<3, float> minimumCorner() const;
+		MathTypes::Vector<3, float> maximumCorner() const;
+		MathTypes::Vector<3, float> centroid() const;
+		float surfaceArea() const;
+		bool isEmpty() const;
+
+		BoundingBox enclosing(const BoundingBox& other) const;
+		BoundingBox enclosing(const MathTypes::Vector<3, float>& point) const;
+		BoundingBox expandedBy(float distance) const;
+
+		//Distance along the ray at which it enters the box, if it does so before maximumDistance.
+		//inverseDirection is the componentwise reciprocal of the ray direction, passed in so that it is only
+		//calculated once per ray rather than once per box.
+		std::optional<float> entryDistance(
+			const Ray& ray,
+			const MathTypes::Vector<3, float>& inverseDirection,
+			float maximumDistance) const;
+
+	private:
+		MathTypes::Vector<3, float> minimumCorner_;
+		MathTypes::Vector<3, float> maximumCorner_;
+	};
+}
+
+inline RayTracing::BoundingBox::BoundingBox(
+	const MathTypes::Vector<3, float>& minimumCorner,
+	const MathTypes::Vector<3, float>& maximumCorner)
+	: minimumCorner_(minimumCorner)
+	, maximumCorner_(maximumCorner)
+{
+}
+
+inline RayTracing::BoundingBox RayTracing::BoundingBox::emptyBox()
+{
+	const float infinity = std::numeric_limits<float>::infinity();
+	return BoundingBox(
+		MathTypes::Vector<3, float>(infinity, infinity, infinity),
+		MathTypes::Vector<3, float>(-infinity, -infinity, -infinity));
+}
+
+inline MathTypes::Vector<3, float> RayTracing::BoundingBox::minimumCorner() const
+{
+	return minimumCorner_;
+}
+
+inline MathTypes::Vector<3, float> RayTracing::BoundingBox::maximumCorner() const
+{
+	return maximumCorner_;
+}
+
+inline MathTypes::Vector<3, float> RayTracing::BoundingBox::centroid() const
+{
+	return 0.5 * (minimumCorner_ + maximumCorner_);
+}
+
+inline float RayTracing::BoundingBox::surfaceArea() const
+{
+	if(isEmpty())
+	{
+		return 0;
+	}
+
+	auto extent = maximumCorner_ - minimumCorner_;
+	return 2 * (extent.xValue() * extent.yValue() + extent.yValue() * extent.zValue() + extent.zValue() * extent.xValue());
+}
+
+inline bool RayTracing::BoundingBox::isEmpty() const
+{
+	return minimumCorner_.xValue() > maximumCorner_.xValue()
+		|| minimumCorner_.yValue() > maximumCorner_.yValue()
+		|| minimumCorner_.zValue() > maximumCorner_.zValue();
+}
+
+inline RayTracing::BoundingBox RayTracing::BoundingBox::enclosing(const BoundingBox& other) const
+{
+	return BoundingBox(
+		MathTypes::Vector<3, float>(
+			std::min(minimumCorner_.xValue(), other.minimumCorner_.xValue()),
+			std::min(minimumCorner_.yValue(), other.minimumCorner_.yValue()),
+			std::min(minimumCorner_.zValue(), other.minimumCorner_.zValue())),
+		MathTypes::Vector<3, float>(
+			std::max(maximumCorner_.xValue(), other.maximumCorner_.xValue()),
+			std::max(maximumCorner_.yValue(), other.maximumCorner_.yValue()),
+			std::max(maximumCorner_.zValue(), other.maximumCorner_.zValue())));
+}
+
+inline RayTracing::BoundingBox RayTracing::BoundingBox::enclosing(const MathTypes::Vector<3, float>& point) const
+{
+	return enclosing(BoundingBox(point, point));
+}
+
+inline RayTracing::BoundingBox RayTracing::BoundingBox::expandedBy(float distance) const
+{
+	const MathTypes::Vector<3, float> distanceInEachDirection(distance, distance, distance);
+	return BoundingBox(minimumCorner_ - distanceInEachDirection, maximumCorner_ + distanceInEachDirection);
+}
+
+inline std::optional<float> RayTracing::BoundingBox::entryDistance(
+	const Ray& ray,
+	const MathTypes::Vector<3, float>& inverseDirection,
+	float maximumDistance) const
+{
+	//Slab test. Each pair of planes clips the interval [nearest, farthest] along the ray.
+	auto origin = ray.origin();
+	float nearest = 0;
+	float farthest = maximumDistance;
+
+	auto clipToSlab = [&](float originComponent, float inverseDirectionComponent, float slabMinimum, float slabMaximum)
+	{
+		float distanceToMinimum = (slabMinimum - originComponent) * inverseDirectionComponent;
+		float distanceToMaximum = (slabMaximum - originComponent) * inverseDirectionComponent;
+		if(distanceToMinimum > distanceToMaximum)
+		{
+			std::swap(distanceToMinimum, distanceToMaximum);
+		}
+		//Written so that NaNs (from a zero direction component lying on a slab plane) leave the interval unchanged
+		nearest = distanceToMinimum > nearest ? distanceToMinimum : nearest;
+		farthest = distanceToMaximum < farthest ? distanceToMaximum : farthest;
+	};
+
+	clipToSlab(origin.xValue(), inverseDirection.xValue(), minimumCorner_.xValue(), maximumCorner_.xValue());
+	clipToSlab(origin.yValue(), inverseDirection.yValue(), minimumCorner_.yValue(), maximumCorner_.yValue());
+	clipToSlab(origin.zValue(), inverseDirection.zValue(), minimumCorner_.zValue(), maximumCorner_.zValue());
+
+	if(nearest <= farthest)
+	{
+		return nearest;
+	}
+	else
+	{
+		return std::nullopt;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,318 @@
+#include "assignmentSpecific/BoundingVolumeHierarchy.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "assignmentSpecific/I_IntersectableShape.h"
+#include "math/LinearMath.h"
+#include "math/Vector.h"
+
+namespace
+{
+	const int MAXIMUM_OBJECTS_PER_LEAF = 2;
+	const int MAXIMUM_TRAVERSAL_DEPTH = 64;
+
+	//Keeps rays that graze the edge of an object, or flat objects like quadrilaterals, from being culled by
+	//floating point error in the box test.
+	const float BOUNDS_PADDING = 1e-3;
+
+	using Clock = std::chrono::steady_clock;
+
+	double millisecondsSince(const Clock::time_point& start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	float componentAlongAxis(const MathTypes::Vector<3, float>& vector, int axis)
+	{
+		switch(axis)
+		{
+			case(0):
+				return vector.xValue();
+			case(1):
+				return vector.yValue();
+			default:
+				return vector.zValue();
+		}
+	}
+
+	MathTypes::Vector<3, float> inverseOfDirection(const RayTracing::Ray& ray)
+	{
+		auto direction = ray.direction();
+		return MathTypes::Vector<3, float>(1 / direction.xValue(), 1 / direction.yValue(), 1 / direction.zValue());
+	}
+}
+
+RayTracing::BoundingVolumeHierarchy::BoundingVolumeHierarchy(
+	const std::list<std::shared_ptr<I_IntersectableShape>>& objects,
+	float rebuildThreshold)
+	: rebuildThreshold_(rebuildThreshold)
+	, costWhenBuilt_(0)
+{
+	objects_.reserve(objects.size());
+	for(const auto& object : objects)
+	{
+		objects_.push_back(BoundedObject{object.get(), BoundingBox::emptyBox()});
+	}
+	rebuild();
+}
+
+void RayTracing::BoundingVolumeHierarchy::update()
+{
+	auto refitStart = Clock::now();
+	refit();
+	statistics_.numberOfRefits++;
+	statistics_.millisecondsSpentRefitting += millisecondsSince(refitStart);
+
+	if(traversalCost() > rebuildThreshold_ * costWhenBuilt_)
+	{
+		rebuild();
+	}
+}
+
+void RayTracing::BoundingVolumeHierarchy::rebuild()
+{
+	auto rebuildStart = Clock::now();
+
+	nodes_.clear();
+	if(!objects_.empty())
+	{
+		for(auto& boundedObject : objects_)
+		{
+			boundedObject.bounds = boundedObject.object->boundingBox().expandedBy(BOUNDS_PADDING);
+		}
+		nodes_.reserve(2 * objects_.size());
+		nodes_.push_back(Node{BoundingBox::emptyBox(), 0, 0});
+		buildNode(0, 0, objects_.size());
+	}
+	costWhenBuilt_ = traversalCost();
+
+	statistics_.numberOfRebuilds++;
+	statistics_.millisecondsSpentRebuilding += millisecondsSince(rebuildStart);
+}
+
+void RayTracing::BoundingVolumeHierarchy::buildNode(int nodeIndex, int firstObject, int numberOfObjects)
+{
+	auto bounds = BoundingBox::emptyBox();
+	auto boundsOfCentroids = BoundingBox::emptyBox();
+	for(int i = firstObject; i < firstObject + numberOfObjects; i++)
+	{
+		bounds = bounds.enclosing(objects_[i].bounds);
+		boundsOfCentroids = boundsOfCentroids.enclosing(objects_[i].bounds.centroid());
+	}
+
+	if(numberOfObjects <= MAXIMUM_OBJECTS_PER_LEAF)
+	{
+		nodes_[nodeIndex] = Node{bounds, firstObject, numberOfObjects};
+		return;
+	}
+
+	//Split at the median centroid along the axis the centroids are most spread out on
+	auto centroidExtent = boundsOfCentroids.maximumCorner() - boundsOfCentroids.minimumCorner();
+	int splitAxis = 0;
+	if(centroidExtent.yValue() > componentAlongAxis(centroidExtent, splitAxis))
+	{
+		splitAxis = 1;
+	}
+	if(centroidExtent.zValue() > componentAlongAxis(centroidExtent, splitAxis))
+	{
+		splitAxis = 2;
+	}
+
+	const int numberOfObjectsOnLeft = numberOfObjects / 2;
+	auto first = std::begin(objects_) + firstObject;
+	std::nth_element(first, first + numberOfObjectsOnLeft, first + numberOfObjects,
+		[=](const BoundedObject& a, const BoundedObject& b)
+		{
+			return componentAlongAxis(a.bounds.centroid(), splitAxis) < componentAlongAxis(b.bounds.centroid(), splitAxis);
+		});
+
+	const int firstChild = nodes_.size();
+	nodes_[nodeIndex] = Node{bounds, firstChild, 0};
+	nodes_.push_back(Node{BoundingBox::emptyBox(), 0, 0});
+	nodes_.push_back(Node{BoundingBox::emptyBox(), 0, 0});
+	buildNode(firstChild, firstObject, numberOfObjectsOnLeft);
+	buildNode(firstChild + 1, firstObject + numberOfObjectsOnLeft, numberOfObjects - numberOfObjectsOnLeft);
+}
+
+void RayTracing::BoundingVolumeHierarchy::refit()
+{
+	for(auto& boundedObject : objects_)
+	{
+		boundedObject.bounds = boundedObject.object->boundingBox().expandedBy(BOUNDS_PADDING);
+	}
+
+	//Children are always stored after their parents, so walking backwards visits every child before its parent
+	for(int i = nodes_.size() - 1; i >= 0; i--)
+	{
+		auto& node = nodes_[i];
+		if(node.isLeaf())
+		{
+			auto bounds = BoundingBox::emptyBox();
+			for(int j = node.firstChildOrObject; j < node.firstChildOrObject + node.numberOfObjects; j++)
+			{
+				bounds = bounds.enclosing(objects_[j].bounds);
+			}
+			node.bounds = bounds;
+		}
+		else
+		{
+			node.bounds = nodes_[node.firstChildOrObject].bounds.enclosing(nodes_[node.firstChildOrObject + 1].bounds);
+		}
+	}
+}
+
+float RayTracing::BoundingVolumeHierarchy::traversalCost() const
+{
+	//Surface area heuristic. The chance of a ray hitting a node is proportional to the node's surface area.
+	if(nodes_.empty() || nodes_[0].bounds.surfaceArea() == 0)
+	{
+		return 0;
+	}
+
+	const float areaOfRoot = nodes_[0].bounds.surfaceArea();
+	float cost = 0;
+	for(const auto& node : nodes_)
+	{
+		const float numberOfTests = node.isLeaf() ? node.numberOfObjects : 1;
+		cost += numberOfTests * node.bounds.surfaceArea() / areaOfRoot;
+	}
+	return cost;
+}
+
+std::optional<MathTypes::Vector<3, float>> RayTracing::BoundingVolumeHierarchy::closestIntersectionPoint(
+	I_IntersectableShape** closestIntersectedShape,
+	const Ray& ray) const
+{
+	if(nodes_.empty())
+	{
+		return std::nullopt;
+	}
+
+	const auto inverseDirection = inverseOfDirection(ray);
+	I_IntersectableShape* temporaryClosestIntersectedShape = NULL;
+	MathTypes::Vector<3, float> closestIntersectionPointOfAllObjects(0, 0, 0);
+	float closestDistanceSquared = std::numeric_limits<float>::infinity();
+	float closestDistance = std::numeric_limits<float>::infinity();
+
+	int nodesToVisit[MAXIMUM_TRAVERSAL_DEPTH];
+	int numberOfNodesToVisit = 0;
+	nodesToVisit[numberOfNodesToVisit++] = 0;
+	while(numberOfNodesToVisit > 0)
+	{
+		const auto& node = nodes_[nodesToVisit[--numberOfNodesToVisit]];
+		if(!node.bounds.entryDistance(ray, inverseDirection, closestDistance))
+		{
+			continue;
+		}
+
+		if(node.isLeaf())
+		{
+			for(int i = node.firstChildOrObject; i < node.firstChildOrObject + node.numberOfObjects; i++)
+			{
+				auto closestIntersectionPointOfObject = objects_[i].object->closestIntersectionPoint(ray);
+				if(!closestIntersectionPointOfObject)
+				{
+					continue;
+				}
+
+				float distanceSquared = LinearMath::distanceBetweenPointsSquared(ray.origin(), *closestIntersectionPointOfObject);
+				if(distanceSquared < closestDistanceSquared)
+				{
+					temporaryClosestIntersectedShape = objects_[i].object;
+					closestIntersectionPointOfAllObjects = *closestIntersectionPointOfObject;
+					closestDistanceSquared = distanceSquared;
+					closestDistance = std::sqrt(distanceSquared);
+				}
+			}
+		}
+		else
+		{
+			//Visit the nearer child first so that farther subtrees can be culled by the closest hit so far
+			int nearChild = node.firstChildOrObject;
+			int farChild = node.firstChildOrObject + 1;
+			auto distanceToNearChild = nodes_[nearChild].bounds.entryDistance(ray, inverseDirection, closestDistance);
+			auto distanceToFarChild = nodes_[farChild].bounds.entryDistance(ray, inverseDirection, closestDistance);
+			if(distanceToNearChild && distanceToFarChild && *distanceToFarChild < *distanceToNearChild)
+			{
+				std::swap(nearChild, farChild);
+				std::swap(distanceToNearChild, distanceToFarChild);
+			}
+
+			if(distanceToFarChild)
+			{
+				nodesToVisit[numberOfNodesToVisit++] = farChild;
+			}
+			if(distanceToNearChild)
+			{
+				nodesToVisit[numberOfNodesToVisit++] = nearChild;
+			}
+		}
+	}
+
+	if(temporaryClosestIntersectedShape != NULL)
+	{
+		*closestIntersectedShape = temporaryClosestIntersectedShape;
+		return closestIntersectionPointOfAllObjects;
+	}
+	else
+	{
+		return std::nullopt;
+	}
+}
+
+bool RayTracing::BoundingVolumeHierarchy::rayIntersectsAnObject(const Ray& ray, float maximumDistance) const
+{
+	if(nodes_.empty())
+	{
+		return false;
+	}
+
+	const auto inverseDirection = inverseOfDirection(ray);
+	const float maximumDistanceSquared = maximumDistance * maximumDistance;
+
+	int nodesToVisit[MAXIMUM_TRAVERSAL_DEPTH];
+	int numberOfNodesToVisit = 0;
+	nodesToVisit[numberOfNodesToVisit++] = 0;
+	while(numberOfNodesToVisit > 0)
+	{
+		const auto& node = nodes_[nodesToVisit[--numberOfNodesToVisit]];
+		if(!node.bounds.entryDistance(ray, inverseDirection, maximumDistance))
+		{
+			continue;
+		}
+
+		if(node.isLeaf())
+		{
+			for(int i = node.firstChildOrObject; i < node.firstChildOrObject + node.numberOfObjects; i++)
+			{
+				auto intersectionPointsOfObject = objects_[i].object->intersectionPoints(ray);
+				if(!intersectionPointsOfObject)
+				{
+					continue;
+				}
+				for(const auto& point : *intersectionPointsOfObject)
+				{
+					if(LinearMath::distanceBetweenPointsSquared(ray.origin(), point) < maximumDistanceSquared)
+					{
+						return true;
+					}
+				}
+			}
+		}
+		else
+		{
+			nodesToVisit[numberOfNodesToVisit++] = node.firstChildOrObject;
+			nodesToVisit[numberOfNodesToVisit++] = node.firstChildOrObject + 1;
+		}
+	}
+	return false;
+}
+
+RayTracing::BoundingVolumeHierarchy::Statistics RayTracing::BoundingVolumeHierarchy::statistics() const
+{
+	return statistics_;
+}
\ No newline at end of file
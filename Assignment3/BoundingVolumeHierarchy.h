@@ -0,0 +1,86 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "assignmentSpecific/BoundingBox.h"
+#include "assignmentSpecific/I_SceneGeometry.h"
+#include "assignmentSpecific/Ray.h"
+
+namespace MathTypes
+{
+	template<int dimensions, typename CoordinatePrimitive> class Vector;
+}
+
+namespace RayTracing
+{
+	class I_IntersectableShape;
+
+	//Bounding hierarchy over the objects of a scene. When objects move, the hierarchy can be refit in O(n) by
+	//recomputing node bounds bottom-up while keeping its topology. Refitting degrades the quality of the
+	//hierarchy as objects drift apart, so it is rebuilt from scratch once its estimated traversal cost grows past
+	//rebuildThreshold times the cost it had when it was last built.
+	class BoundingVolumeHierarchy : public I_SceneGeometry
+	{
+	public:
+		struct Statistics
+		{
+			int numberOfRefits = 0;
+			int numberOfRebuilds = 0;
+			double millisecondsSpentRefitting = 0;
+			double millisecondsSpentRebuilding = 0;
+		};
+
+		static constexpr float DEFAULT_REBUILD_THRESHOLD = 1.5;
+
+		BoundingVolumeHierarchy(
+			const std::list<std::shared_ptr<I_IntersectableShape>>& objects,
+			float rebuildThreshold = DEFAULT_REBUILD_THRESHOLD);
+		~BoundingVolumeHierarchy() = default;
+
+		//Refits the hierarchy, and rebuilds it if refitting made it too costly
+		void update() override;
+		void rebuild();
+
+		std::optional<MathTypes::Vector<3, float>> closestIntersectionPoint(
+			I_IntersectableShape** closestIntersectedShape,
+			const Ray& ray) const override;
+		bool rayIntersectsAnObject(const Ray& ray, float maximumDistance) const override;
+
+		Statistics statistics() const;
+
+	private:
+		//Children of an interior node are stored next to each other, after their parent. Leaves refer to a range
+		//of objects_.
+		struct Node
+		{
+			BoundingBox bounds;
+			int firstChildOrObject;
+			int numberOfObjects;
+
+			bool isLeaf() const
+			{
+				return numberOfObjects > 0;
+			}
+		};
+
+		struct BoundedObject
+		{
+			I_IntersectableShape* object;
+			BoundingBox bounds;
+		};
+
+		void buildNode(int nodeIndex, int firstObject, int numberOfObjects);
+		void refit();
+		float traversalCost() const;
+
+	private:
+		std::vector<BoundedObject> objects_;
+		std::vector<Node> nodes_;
+		float rebuildThreshold_;
+		float costWhenBuilt_;
+		Statistics statistics_;
+	};
+}
\ No newline at end of file
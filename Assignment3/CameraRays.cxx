@@ -0,0 +1,188 @@
+#include "assignmentSpecific/CameraRays.h"
+
+#include <cassert>
+
+#include "assignmentSpecific/TutorialLibraries/ImagePlane.h"
+
+#include "math/Vector.h"
+#include "math/VectorLanes.h"
+
+namespace
+{
+	//Components of the step between two points on the image plane that are a number of pixels apart
+	struct Step
+	{
+		float x;
+		float y;
+		float z;
+	};
+
+	Step stepBetweenPoints(
+		const MathTypes::Vector<3, float>& from,
+		const MathTypes::Vector<3, float>& to,
+		int pixelsApart)
+	{
+		if(pixelsApart == 0)
+		{
+			return Step{0, 0, 0};
+		}
+		const float inversePixelsApart = 1.0f / pixelsApart;
+		return Step{
+			(to.xValue() - from.xValue()) * inversePixelsApart,
+			(to.yValue() - from.yValue()) * inversePixelsApart,
+			(to.zValue() - from.zValue()) * inversePixelsApart};
+	}
+
+	const int LANES = 4;
+
+	//Scalar version of the kernel, for the rays left over after the last full group of lanes. The vector kernel
+	//performs the same operations in the same order, and the reciprocal square root goes through the lanes here
+	//too, so a ray comes out the same whichever lane it falls in.
+	float inverseSquareRoot(float value)
+	{
+		using namespace MathTypes::VectorLanes;
+		return component<0>(approximateReciprocalSquareRoot(broadcast(value)));
+	}
+
+	void rayAtRow(
+		int i,
+		float row,
+		float startX, float startY, float startZ,
+		const Step& stepDown,
+		float eyeX, float eyeY, float eyeZ,
+		float* originX, float* originY, float* originZ,
+		float* directionX, float* directionY, float* directionZ)
+	{
+		originX[i] = startX + row * stepDown.x;
+		originY[i] = startY + row * stepDown.y;
+		originZ[i] = startZ + row * stepDown.z;
+
+		const float x = originX[i] - eyeX;
+		const float y = originY[i] - eyeY;
+		const float z = originZ[i] - eyeZ;
+		const float inverseLength = inverseSquareRoot(x * x + y * y + z * z);
+		directionX[i] = x * inverseLength;
+		directionY[i] = y * inverseLength;
+		directionZ[i] = z * inverseLength;
+	}
+}
+
+void RayTracing::CameraRays::generate(
+	const ImagePlane& imagePlane,
+	const MathTypes::Vector<3, float>& eyePosition,
+	int firstX,
+	int firstY,
+	int width,
+	int height)
+{
+	using namespace MathTypes::VectorLanes;
+	assert(width > 0 && height > 0);
+	const int rays = width * height;
+	for(auto* component : {&originX_, &originY_, &originZ_, &directionX_, &directionY_, &directionZ_})
+	{
+		component->resize(rays);
+	}
+
+	//Every point is a whole number of steps from the top left corner, rather than a step from its neighbour, so
+	//that rounding errors don't build up across the rectangle
+	const auto topLeft = imagePlane.pixelTo3D(firstX, firstY);
+	const Step stepAcross = stepBetweenPoints(topLeft, imagePlane.pixelTo3D(firstX + width - 1, firstY), width - 1);
+	const Step stepDown = stepBetweenPoints(topLeft, imagePlane.pixelTo3D(firstX, firstY + height - 1), height - 1);
+	const float eyeX = eyePosition.xValue();
+	const float eyeY = eyePosition.yValue();
+	const float eyeZ = eyePosition.zValue();
+
+	for(int column = 0; column < width; column++)
+	{
+		const float startX = topLeft.xValue() + column * stepAcross.x;
+		const float startY = topLeft.yValue() + column * stepAcross.y;
+		const float startZ = topLeft.zValue() + column * stepAcross.z;
+		const int first = column * height;
+
+		int row = 0;
+		const Lanes columnStartX = broadcast(startX);
+		const Lanes columnStartY = broadcast(startY);
+		const Lanes columnStartZ = broadcast(startZ);
+		const Lanes stepDownX = broadcast(stepDown.x);
+		const Lanes stepDownY = broadcast(stepDown.y);
+		const Lanes stepDownZ = broadcast(stepDown.z);
+		const Lanes eyeLanesX = broadcast(eyeX);
+		const Lanes eyeLanesY = broadcast(eyeY);
+		const Lanes eyeLanesZ = broadcast(eyeZ);
+		//Row numbers are small whole numbers, which floats hold exactly
+		Lanes rowOfLanes = fromComponents(0, 1, 2, 3);
+		const Lanes rowsPerGroup = broadcast(LANES);
+		for(; row + LANES <= height; row += LANES)
+		{
+			const int i = first + row;
+			const Lanes pointX = sum(columnStartX, product(rowOfLanes, stepDownX));
+			const Lanes pointY = sum(columnStartY, product(rowOfLanes, stepDownY));
+			const Lanes pointZ = sum(columnStartZ, product(rowOfLanes, stepDownZ));
+			toArray(pointX, &originX_[i]);
+			toArray(pointY, &originY_[i]);
+			toArray(pointZ, &originZ_[i]);
+
+			const Lanes x = difference(pointX, eyeLanesX);
+			const Lanes y = difference(pointY, eyeLanesY);
+			const Lanes z = difference(pointZ, eyeLanesZ);
+			const Lanes inverseLength = approximateReciprocalSquareRoot(
+				sum(sum(product(x, x), product(y, y)), product(z, z)));
+			toArray(product(x, inverseLength), &directionX_[i]);
+			toArray(product(y, inverseLength), &directionY_[i]);
+			toArray(product(z, inverseLength), &directionZ_[i]);
+
+			rowOfLanes = sum(rowOfLanes, rowsPerGroup);
+		}
+		for(; row < height; row++)
+		{
+			rayAtRow(first + row, row,
+				startX, startY, startZ,
+				stepDown,
+				eyeX, eyeY, eyeZ,
+				originX_.data(), originY_.data(), originZ_.data(),
+				directionX_.data(), directionY_.data(), directionZ_.data());
+		}
+	}
+}
+
+int RayTracing::CameraRays::numberOfRays() const
+{
+	return originX_.size();
+}
+
+RayTracing::Ray RayTracing::CameraRays::ray(int i) const
+{
+	return Ray::withUnitDirection(
+		MathTypes::Vector<3, float>(originX_[i], originY_[i], originZ_[i]),
+		MathTypes::Vector<3, float>(directionX_[i], directionY_[i], directionZ_[i]));
+}
+
+const float* RayTracing::CameraRays::originX() const
+{
+	return originX_.data();
+}
+
+const float* RayTracing::CameraRays::originY() const
+{
+	return originY_.data();
+}
+
+const float* RayTracing::CameraRays::originZ() const
+{
+	return originZ_.data();
+}
+
+const float* RayTracing::CameraRays::directionX() const
+{
+	return directionX_.data();
+}
+
+const float* RayTracing::CameraRays::directionY() const
+{
+	return directionY_.data();
+}
+
+const float* RayTracing::CameraRays::directionZ() const
+{
+	return directionZ_.data();
+}
\ No newline at end of file
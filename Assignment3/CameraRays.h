@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+
+#include "assignmentSpecific/Ray.h"
+
+namespace MathTypes
+{
+	template<int dimensions, typename CoordinatePrimitive> class Vector;
+}
+
+namespace RayTracing
+{
+	class ImagePlane;
+
+	//Generates the primary rays through a rectangle of pixels at once, stored one array per component. Only the
+	//corners of the rectangle are placed with ImagePlane::pixelTo3D(); the points in between are stepped to from
+	//them, and the directions are normalised four at a time with VectorLanes::approximateReciprocalSquareRoot(),
+	//which is accurate to a few parts in ten million. Rays are ordered column by column, top to bottom within each
+	//column, the order the ray tracer visits pixels in.
+	class CameraRays
+	{
+	public:
+		CameraRays() = default;
+		~CameraRays() = default;
+
+		//Rays start on the image plane and point away from the eye. firstX and firstY are in pixels of the image.
+		void generate(
+			const ImagePlane& imagePlane,
+			const MathTypes::Vector<3, float>& eyePosition,
+			int firstX,
+			int firstY,
+			int width,
+			int height);
+
+		int numberOfRays() const;
+		//Ray i is the ray through pixel (firstX + i / height, firstY + i % height)
+		Ray ray(int i) const;
+
+		//Batched tracing can read the components directly. Directions have unit length.
+		const float* originX() const;
+		const float* originY() const;
+		const float* originZ() const;
+		const float* directionX() const;
+		const float* directionY() const;
+		const float* directionZ() const;
+
+	private:
+		std::vector<float> originX_, originY_, originZ_;
+		std::vector<float> directionX_, directionY_, directionZ_;
+	};
+}
\ No newline at end of file
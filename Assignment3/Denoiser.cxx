@@ -0,0 +1,359 @@
+#include "assignmentSpecific/Denoiser.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "assignmentSpecific/TutorialLibraries/grid2.h"
+#include "assignmentSpecific/TutorialLibraries/image.h"
+
+#include "assignmentSpecific/GeometryBuffer.h"
+#include "glUtility/Vertex.h"
+#include "math/VectorLanes.h"
+
+namespace
+{
+	const float KERNEL[5] = {1.0 / 16, 1.0 / 4, 3.0 / 8, 1.0 / 4, 1.0 / 16};
+	const float NO_OBJECT = -1;
+
+	//Depth differences are measured relative to depth, and to how far apart the taps are
+	const float DEPTH_TOLERANCE = 0.02;
+	//Halved after every pass, since each pass has less noise left to remove
+	const float COLOUR_TOLERANCE = 0.3;
+
+	//Normal, depth and object of every pixel, each stored as its own plane
+	struct GuidePlanes
+	{
+		GuidePlanes(int numberOfPixels)
+			: normalX(numberOfPixels), normalY(numberOfPixels), normalZ(numberOfPixels)
+			, depth(numberOfPixels), inverseDepth(numberOfPixels), objectId(numberOfPixels)
+		{
+		}
+
+		std::vector<float> normalX, normalY, normalZ;
+		//Zero where nothing was hit, so that no infinities reach the weights
+		std::vector<float> depth, inverseDepth;
+		//Floats, which hold the ids of the first 2^24 objects exactly, so that they can be compared in the lanes
+		std::vector<float> objectId;
+	};
+
+	struct ColourPlanes
+	{
+		ColourPlanes(int numberOfPixels)
+			: red(numberOfPixels), green(numberOfPixels), blue(numberOfPixels)
+		{
+		}
+
+		std::vector<float> red, green, blue;
+	};
+
+	//exp(-x) for x >= 0 as (1 - x/32)^32, five squarings, which is much cheaper than std::exp. It is never more than
+	//0.009 below exp(-x). Relative to exp(-x) the error grows as about x^2/64, to 6% at x = 2 and 24% at x = 4, but
+	//by then the weight is below 0.02 and hardly contributes to the blur.
+	inline float approximateNegativeExponential(float x)
+	{
+		float power = std::max(0.0f, 1 - x * (1.0f / 32));
+		for(int i = 0; i < 5; i++)
+		{
+			power = power * power;
+		}
+		return power;
+	}
+
+	//(N.Nq)^32, so creases sharper than roughly 15 degrees stop the blur
+	inline float sharpenedNormalWeight(float normalDotNormal)
+	{
+		const float squared = normalDotNormal * normalDotNormal;
+		const float fourth = squared * squared;
+		const float eighth = fourth * fourth;
+		const float sixteenth = eighth * eighth;
+		return sixteenth * sixteenth;
+	}
+
+	//One tap of the kernel, applied along a row: the planes at the centre pixels, the planes at the pixels the
+	//tap lands on, and the sums being accumulated for the centre pixels
+	struct TapAlongRow
+	{
+		const float* centreNormalX;
+		const float* centreNormalY;
+		const float* centreNormalZ;
+		const float* centreDepth;
+		const float* centreInverseDepth;
+		const float* centreObjectId;
+		const float* centreRed;
+		const float* centreGreen;
+		const float* centreBlue;
+		const float* tapNormalX;
+		const float* tapNormalY;
+		const float* tapNormalZ;
+		const float* tapDepth;
+		const float* tapObjectId;
+		const float* tapRed;
+		const float* tapGreen;
+		const float* tapBlue;
+		float* sumOfWeights;
+		float* sumOfRed;
+		float* sumOfGreen;
+		float* sumOfBlue;
+		float kernelWeight;
+		float inverseDepthTolerance;
+		float inverseColourVariance;
+	};
+
+	const int LANES = 4;
+
+	//Scalar version of the kernel, for the pixels left over after the last full group of lanes. The vector kernel
+	//performs the same operations in the same order.
+	void accumulateTap(int x, const TapAlongRow& t)
+	{
+		const float normalWeight = sharpenedNormalWeight(std::max(0.0f,
+			t.centreNormalX[x] * t.tapNormalX[x] + t.centreNormalY[x] * t.tapNormalY[x] + t.centreNormalZ[x] * t.tapNormalZ[x]));
+
+		const float relativeDepthChange = std::abs(t.centreDepth[x] - t.tapDepth[x]) * t.centreInverseDepth[x];
+		const float redChange = t.centreRed[x] - t.tapRed[x];
+		const float greenChange = t.centreGreen[x] - t.tapGreen[x];
+		const float blueChange = t.centreBlue[x] - t.tapBlue[x];
+		const float colourChangeSquared = redChange * redChange + greenChange * greenChange + blueChange * blueChange;
+
+		const float edgeWeight = normalWeight * approximateNegativeExponential(
+			relativeDepthChange * t.inverseDepthTolerance + colourChangeSquared * t.inverseColourVariance);
+		const float weight = t.centreObjectId[x] == t.tapObjectId[x] ? t.kernelWeight * edgeWeight : 0.0f;
+		t.sumOfWeights[x] += weight;
+		t.sumOfRed[x] += weight * t.tapRed[x];
+		t.sumOfGreen[x] += weight * t.tapGreen[x];
+		t.sumOfBlue[x] += weight * t.tapBlue[x];
+	}
+
+	void accumulateTapOnLanes(int x, const TapAlongRow& t)
+	{
+		using namespace MathTypes::VectorLanes;
+		const Lanes zero = broadcast(0);
+		const Lanes one = broadcast(1);
+
+		Lanes normalWeight = sum(sum(
+			product(fromArray(&t.centreNormalX[x]), fromArray(&t.tapNormalX[x])),
+			product(fromArray(&t.centreNormalY[x]), fromArray(&t.tapNormalY[x]))),
+			product(fromArray(&t.centreNormalZ[x]), fromArray(&t.tapNormalZ[x])));
+		normalWeight = maximum(zero, normalWeight);
+		for(int i = 0; i < 5; i++)
+		{
+			normalWeight = product(normalWeight, normalWeight);
+		}
+
+		const Lanes relativeDepthChange = product(
+			absolute(difference(fromArray(&t.centreDepth[x]), fromArray(&t.tapDepth[x]))),
+			fromArray(&t.centreInverseDepth[x]));
+		const Lanes tapRed = fromArray(&t.tapRed[x]);
+		const Lanes tapGreen = fromArray(&t.tapGreen[x]);
+		const Lanes tapBlue = fromArray(&t.tapBlue[x]);
+		const Lanes redChange = difference(fromArray(&t.centreRed[x]), tapRed);
+		const Lanes greenChange = difference(fromArray(&t.centreGreen[x]), tapGreen);
+		const Lanes blueChange = difference(fromArray(&t.centreBlue[x]), tapBlue);
+		const Lanes colourChangeSquared = sum(sum(
+			product(redChange, redChange), product(greenChange, greenChange)), product(blueChange, blueChange));
+
+		const Lanes exponent = sum(
+			product(relativeDepthChange, broadcast(t.inverseDepthTolerance)),
+			product(colourChangeSquared, broadcast(t.inverseColourVariance)));
+		Lanes exponential = maximum(zero, difference(one, product(exponent, broadcast(1.0f / 32))));
+		for(int i = 0; i < 5; i++)
+		{
+			exponential = product(exponential, exponential);
+		}
+
+		const Lanes weight = zeroedWhereDifferent(
+			product(broadcast(t.kernelWeight), product(normalWeight, exponential)),
+			fromArray(&t.centreObjectId[x]), fromArray(&t.tapObjectId[x]));
+
+		toArray(sum(fromArray(&t.sumOfWeights[x]), weight), &t.sumOfWeights[x]);
+		toArray(sum(fromArray(&t.sumOfRed[x]), product(weight, tapRed)), &t.sumOfRed[x]);
+		toArray(sum(fromArray(&t.sumOfGreen[x]), product(weight, tapGreen)), &t.sumOfGreen[x]);
+		toArray(sum(fromArray(&t.sumOfBlue[x]), product(weight, tapBlue)), &t.sumOfBlue[x]);
+	}
+
+	//Accumulates one tap of the kernel for a whole row at a time, so that neighbouring pixels share lanes
+	void filterRow(
+		int y,
+		int width,
+		int height,
+		int distanceBetweenTaps,
+		float colourTolerance,
+		const GuidePlanes& guide,
+		const ColourPlanes& input,
+		ColourPlanes* output,
+		ColourPlanes* sums,
+		std::vector<float>* totalWeights)
+	{
+		std::fill(std::begin(sums->red), std::end(sums->red), 0.0f);
+		std::fill(std::begin(sums->green), std::end(sums->green), 0.0f);
+		std::fill(std::begin(sums->blue), std::end(sums->blue), 0.0f);
+		std::fill(std::begin(*totalWeights), std::end(*totalWeights), 0.0f);
+
+		const int rowStart = y * width;
+		for(int i = 0; i < 5; i++)
+		{
+			const int tapY = y + (i - 2) * distanceBetweenTaps;
+			if(tapY < 0 || tapY >= height)
+			{
+				continue;
+			}
+			for(int j = 0; j < 5; j++)
+			{
+				//Taps that would fall outside of the image are skipped
+				const int offset = (j - 2) * distanceBetweenTaps;
+				const int firstX = std::max(0, -offset);
+				const int lastX = std::min(width, width - offset);
+				if(firstX >= lastX)
+				{
+					continue;
+				}
+				const int centre = rowStart + firstX;
+				const int tap = tapY * width + offset + firstX;
+
+				TapAlongRow t;
+				t.centreNormalX = &guide.normalX[centre];
+				t.centreNormalY = &guide.normalY[centre];
+				t.centreNormalZ = &guide.normalZ[centre];
+				t.centreDepth = &guide.depth[centre];
+				t.centreInverseDepth = &guide.inverseDepth[centre];
+				t.centreObjectId = &guide.objectId[centre];
+				t.centreRed = &input.red[centre];
+				t.centreGreen = &input.green[centre];
+				t.centreBlue = &input.blue[centre];
+				t.tapNormalX = &guide.normalX[tap];
+				t.tapNormalY = &guide.normalY[tap];
+				t.tapNormalZ = &guide.normalZ[tap];
+				t.tapDepth = &guide.depth[tap];
+				t.tapObjectId = &guide.objectId[tap];
+				t.tapRed = &input.red[tap];
+				t.tapGreen = &input.green[tap];
+				t.tapBlue = &input.blue[tap];
+				t.sumOfWeights = &(*totalWeights)[firstX];
+				t.sumOfRed = &sums->red[firstX];
+				t.sumOfGreen = &sums->green[firstX];
+				t.sumOfBlue = &sums->blue[firstX];
+				t.kernelWeight = KERNEL[i] * KERNEL[j];
+				t.inverseDepthTolerance = 1 / (DEPTH_TOLERANCE * distanceBetweenTaps);
+				t.inverseColourVariance = 1 / (colourTolerance * colourTolerance);
+
+				const int numberOfPixels = lastX - firstX;
+				int x = 0;
+				for(; x + LANES <= numberOfPixels; x += LANES)
+				{
+					accumulateTapOnLanes(x, t);
+				}
+				for(; x < numberOfPixels; x++)
+				{
+					accumulateTap(x, t);
+				}
+			}
+		}
+
+		for(int x = 0; x < width; x++)
+		{
+			const int centre = rowStart + x;
+			//Nothing was hit, so there is no noise to remove. Otherwise the centre tap always has a weight.
+			if(guide.objectId[centre] == NO_OBJECT || (*totalWeights)[x] <= 0)
+			{
+				output->red[centre] = input.red[centre];
+				output->green[centre] = input.green[centre];
+				output->blue[centre] = input.blue[centre];
+			}
+			else
+			{
+				const float inverseWeight = 1 / (*totalWeights)[x];
+				output->red[centre] = sums->red[x] * inverseWeight;
+				output->green[centre] = sums->green[x] * inverseWeight;
+				output->blue[centre] = sums->blue[x] * inverseWeight;
+			}
+		}
+	}
+}
+
+RayTracing::Denoiser::Denoiser(int numberOfPasses)
+	: numberOfPasses_(numberOfPasses)
+{
+}
+
+void RayTracing::Denoiser::denoise(
+	const GeometryBuffer& geometryBuffer,
+	geometry::Grid2<raster::RGB>* image,
+	int numberOfThreads) const
+{
+	const int width = geometryBuffer.width();
+	const int height = geometryBuffer.height();
+	assert(image->width() == width && image->height() == height);
+
+	GuidePlanes guide(width * height);
+	ColourPlanes input(width * height);
+	std::unordered_map<const I_IntersectableShape*, int> idsOfObjects;
+	for(int y = 0; y < height; y++)
+	{
+		for(int x = 0; x < width; x++)
+		{
+			const auto& sample = geometryBuffer(x, y);
+			const int i = y * width + x;
+			input.red[i] = sample.colour.red;
+			input.green[i] = sample.colour.green;
+			input.blue[i] = sample.colour.blue;
+			guide.normalX[i] = sample.normal.x;
+			guide.normalY[i] = sample.normal.y;
+			guide.normalZ[i] = sample.normal.z;
+			if(sample.object == NULL)
+			{
+				guide.depth[i] = 0;
+				guide.inverseDepth[i] = 0;
+				guide.objectId[i] = NO_OBJECT;
+			}
+			else
+			{
+				guide.depth[i] = sample.depth;
+				guide.inverseDepth[i] = 1 / sample.depth;
+				guide.objectId[i] = idsOfObjects.emplace(sample.object, idsOfObjects.size()).first->second;
+			}
+		}
+	}
+
+	ColourPlanes output(width * height);
+	for(int pass = 0; pass < numberOfPasses_; pass++)
+	{
+		const int distanceBetweenTaps = 1 << pass;
+		const float colourTolerance = COLOUR_TOLERANCE / distanceBetweenTaps;
+
+		std::atomic<int> nextRow(0);
+		auto filterRemainingRows = [&]()
+		{
+			ColourPlanes sums(width);
+			std::vector<float> totalWeights(width);
+			for(int y = nextRow++; y < height; y = nextRow++)
+			{
+				filterRow(y, width, height, distanceBetweenTaps, colourTolerance, guide, input, &output, &sums, &totalWeights);
+			}
+		};
+
+		std::vector<std::thread> workers;
+		for(int i = 1; i < std::min(numberOfThreads, height); i++)
+		{
+			workers.emplace_back(filterRemainingRows);
+		}
+		filterRemainingRows();
+		for(auto& worker : workers)
+		{
+			worker.join();
+		}
+
+		std::swap(input, output);
+	}
+
+	for(int y = 0; y < height; y++)
+	{
+		for(int x = 0; x < width; x++)
+		{
+			const int i = y * width + x;
+			(*image)({x, y}) = raster::convertToRGB(GLUtility::Colour<float>(input.red[i], input.green[i], input.blue[i]));
+		}
+	}
+}
\ No newline at end of file
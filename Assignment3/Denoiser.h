@@ -0,0 +1,42 @@
+#pragma once
+
+#include <thread>
+
+namespace geometry
+{
+	template<typename T> class Grid2;
+}
+
+namespace raster
+{
+	struct RGB;
+}
+
+namespace RayTracing
+{
+	class GeometryBuffer;
+
+	//Edge-avoiding à-trous wavelet filter (Dammertz et al., 2010). Each pass blurs with a 5x5 B-spline kernel
+	//whose taps are spread twice as far apart as the pass before, so a few passes cover a wide area cheaply.
+	//Taps are weighted down where the geometry buffer shows a different object, a crease in the surface normal
+	//or a jump in depth, and where the colour differs sharply, so edges and shadow boundaries stay crisp.
+	//Images are filtered one row per thread at a time, on colour, normal and depth planes stored separately so
+	//that the inner loop over a row reads contiguous memory.
+	class Denoiser
+	{
+	public:
+		static const int DEFAULT_NUMBER_OF_PASSES = 3;
+
+		explicit Denoiser(int numberOfPasses = DEFAULT_NUMBER_OF_PASSES);
+		~Denoiser() = default;
+
+		//Filters the colours of the geometry buffer and writes the result into image, which must be the same size
+		void denoise(
+			const GeometryBuffer& geometryBuffer,
+			geometry::Grid2<raster::RGB>* image,
+			int numberOfThreads = std::thread::hardware_concurrency()) const;
+
+	private:
+		int numberOfPasses_;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+
+#include "assignmentSpecific/BoundingBox.h"
+#include "math/LinearMath.h"
+#include "math/Vector.h"
+
+namespace RayTracing
+{
+	//The pyramid of space that rays from an apex, such as the eye, sweep out on their way through a rectangle,
+	//such as a tile of the image plane. It is bounded by the four planes through the apex and each edge of the
+	//rectangle, and has no near or far plane.
+	class Frustum
+	{
+	public:
+		//The corners must go around the rectangle, in either direction
+		Frustum(const MathTypes::Vector<3, float>& apex, const std::array<MathTypes::Vector<3, float>, 4>& corners);
+		~Frustum() = default;
+
+		//False only if the box lies entirely outside one of the planes of the frustum. A box that lies outside the
+		//frustum near one of its edges may still be reported as overlapping it, which is safe for culling.
+		bool mayOverlap(const BoundingBox& box) const;
+
+	private:
+		MathTypes::Vector<3, float> apex_;
+		//Point into the frustum. Zero for the planes of a rectangle with no width or height, which cull nothing.
+		std::array<MathTypes::Vector<3, float>, 4> inwardNormals_;
+	};
+}
+
+inline RayTracing::Frustum::Frustum(
+	const MathTypes::Vector<3, float>& apex,
+	const std::array<MathTypes::Vector<3, float>, 4>& corners)
+	: apex_(apex)
+	, inwardNormals_{MathTypes::Vector<3, float>(0, 0, 0), MathTypes::Vector<3, float>(0, 0, 0),
+		MathTypes::Vector<3, float>(0, 0, 0), MathTypes::Vector<3, float>(0, 0, 0)}
+{
+	const auto centre = 0.25 * (corners[0] + corners[1] + corners[2] + corners[3]);
+	for(int i = 0; i < 4; i++)
+	{
+		auto normal = LinearMath::crossProduct(corners[i] - apex_, corners[(i + 1) % 4] - apex_);
+		if(LinearMath::dotProduct(normal, centre - apex_) < 0)
+		{
+			normal = -1 * normal;
+		}
+		inwardNormals_[i] = normal;
+	}
+}
+
+inline bool RayTracing::Frustum::mayOverlap(const BoundingBox& box) const
+{
+	const auto minimumCorner = box.minimumCorner();
+	const auto maximumCorner = box.maximumCorner();
+	for(const auto& normal : inwardNormals_)
+	{
+		//The corner of the box farthest along the normal is the last to leave the plane's inside
+		const MathTypes::Vector<3, float> farthestCorner(
+			normal.xValue() >= 0 ? maximumCorner.xValue() : minimumCorner.xValue(),
+			normal.yValue() >= 0 ? maximumCorner.yValue() : minimumCorner.yValue(),
+			normal.zValue() >= 0 ? maximumCorner.zValue() : minimumCorner.zValue());
+		if(LinearMath::dotProduct(normal, farthestCorner - apex_) < 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "glUtility/Vertex.h"
+
+namespace RayTracing
+{
+	class I_IntersectableShape;
+
+	//Per pixel record of what the primary ray through each pixel hit, captured while tracing. Lets passes that
+	//run after tracing, like reconstructing pixels that weren't traced or denoising, tell object edges, creases
+	//and depth discontinuities apart from smooth surfaces.
+	class GeometryBuffer
+	{
+	public:
+		struct Sample
+		{
+			GLUtility::Colour<float> colour = GLUtility::Colour<float>(0, 0, 0);
+			//The object hit by the primary ray, used as the object's ID. NULL if the ray hit nothing.
+			const I_IntersectableShape* object = NULL;
+			//Distance from the image plane to the point hit; infinite if the ray hit nothing
+			float depth = std::numeric_limits<float>::infinity();
+			//Surface normal at the point hit; zero if the ray hit nothing
+			GLUtility::Normal<float> normal = GLUtility::Normal<float>();
+		};
+
+		GeometryBuffer();
+		~GeometryBuffer() = default;
+
+		void resize(int width, int height);
+		int width() const;
+		int height() const;
+
+		Sample& operator()(int x, int y);
+		const Sample& operator()(int x, int y) const;
+
+	private:
+		int width_;
+		int height_;
+		std::vector<Sample> samples_;
+	};
+}
+
+inline RayTracing::GeometryBuffer::GeometryBuffer()
+	: width_(0)
+	, height_(0)
+{
+}
+
+inline void RayTracing::GeometryBuffer::resize(int width, int height)
+{
+	width_ = width;
+	height_ = height;
+	samples_.resize(width * height);
+}
+
+inline int RayTracing::GeometryBuffer::width() const
+{
+	return width_;
+}
+
+inline int RayTracing::GeometryBuffer::height() const
+{
+	return height_;
+}
+
+inline RayTracing::GeometryBuffer::Sample& RayTracing::GeometryBuffer::operator()(int x, int y)
+{
+	return samples_[y * width_ + x];
+}
+
+inline const RayTracing::GeometryBuffer::Sample& RayTracing::GeometryBuffer::operator()(int x, int y) const
+{
+	return samples_[y * width_ + x];
+}
\ No newline at end of file
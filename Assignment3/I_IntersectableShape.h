@@ -1,33 +1,39 @@
-#pragma once
-
-#include <list>
-#include <optional>
-
-#include "assignmentSpecific/Ray.h"
-
-namespace GLUtility
-{
-	template<typename ColourPrimitive> class Colour;
-}
-
-namespace MathTypes
-{
-	template<int dimensions, typename CoordinatePrimitive> class Vector;
-}
-
-namespace RayTracing
-{
-	class I_IntersectableShape
-	{
-	public:
-		~I_IntersectableShape() = default;
-
-		virtual GLUtility::Colour<float> colourOfShape() const = 0;
-		virtual std::optional<MathTypes::Vector<3, float>> surfaceNormalAtPoint(
-			const MathTypes::Vector<3, float>& point) const = 0;
-		virtual bool surfaceIsReflective() const = 0;
-
-		virtual std::optional<std::list<MathTypes::Vector<3, float>>> intersectionPoints(const Ray& ray) const = 0;
-		virtual std::optional<MathTypes::Vector<3, float>> closestIntersectionPoint(const Ray& ray) const = 0;
-	};
+#pragma once
+
+#include <list>
+#include <optional>
+
+#include "assignmentSpecific/Ray.h"
+
+namespace GLUtility
+{
+	template<typename ColourPrimitive> class Colour;
+}
+
+namespace MathTypes
+{
+	template<int rows, int columns, typename CoordinatePrimitive> class Matrix;
+	template<int dimensions, typename CoordinatePrimitive> class Vector;
+}
+
+namespace RayTracing
+{
+	class BoundingBox;
+
+	class I_IntersectableShape
+	{
+	public:
+		~I_IntersectableShape() = default;
+
+		virtual GLUtility::Colour<float> colourOfShape() const = 0;
+		virtual std::optional<MathTypes::Vector<3, float>> surfaceNormalAtPoint(
+			const MathTypes::Vector<3, float>& point) const = 0;
+		virtual bool surfaceIsReflective() const = 0;
+
+		virtual std::optional<std::list<MathTypes::Vector<3, float>>> intersectionPoints(const Ray& ray) const = 0;
+		virtual std::optional<MathTypes::Vector<3, float>> closestIntersectionPoint(const Ray& ray) const = 0;
+
+		virtual BoundingBox boundingBox() const = 0;
+		virtual void transform(const MathTypes::Matrix<4, 4, float>& transformationMatrix) = 0;
+	};
 }
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <optional>
+
+#include "assignmentSpecific/Ray.h"
+
+namespace MathTypes
+{
+	template<int dimensions, typename CoordinatePrimitive> class Vector;
+}
+
+namespace RayTracing
+{
+	class I_IntersectableShape;
+
+	//Answers the ray queries of the ray tracer over all objects of a scene at once
+	class I_SceneGeometry
+	{
+	public:
+		virtual ~I_SceneGeometry() = default;
+
+		virtual std::optional<MathTypes::Vector<3, float>> closestIntersectionPoint(
+			I_IntersectableShape** closestIntersectedShape,
+			const Ray& ray) const = 0;
+		//Whether an object lies along the ray closer than maximumDistance to its origin, such as between a point
+		//and a light
+		virtual bool rayIntersectsAnObject(const Ray& ray, float maximumDistance) const = 0;
+
+		//Call after objects have moved
+		virtual void update() = 0;
+	};
+}
\ No newline at end of file
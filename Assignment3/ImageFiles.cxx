@@ -0,0 +1,268 @@
+#include "assignmentSpecific/ImageFiles.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include <zlib.h>
+
+#include "assignmentSpecific/TutorialLibraries/grid2.h"
+#include "assignmentSpecific/TutorialLibraries/image.h"
+
+namespace
+{
+	const int BYTES_PER_PIXEL = 3;
+	const int ROWS_PER_BAND = 64;
+	const int COMPRESSION_LEVEL = 6;
+
+	const std::uint8_t PNG_SIGNATURE[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+	const std::uint8_t PNG_SUB_FILTER = 1;
+	//Deflate, 32K window, default compression level
+	const std::uint8_t ZLIB_HEADER[] = {0x78, 0x9c};
+
+	struct CompressedBand
+	{
+		std::vector<std::uint8_t> deflatedData;
+		uLong adler32OfRows;
+		uLong lengthOfRows;
+		bool succeeded;
+	};
+
+	std::string extensionOf(const std::string& fileName)
+	{
+		auto dot = fileName.find_last_of('.');
+		if(dot == std::string::npos)
+		{
+			return "";
+		}
+
+		std::string extension = fileName.substr(dot + 1);
+		std::transform(std::begin(extension), std::end(extension), std::begin(extension), ::tolower);
+		return extension;
+	}
+
+	void appendBigEndian(std::vector<std::uint8_t>& bytes, std::uint32_t value)
+	{
+		bytes.push_back(value >> 24);
+		bytes.push_back(value >> 16);
+		bytes.push_back(value >> 8);
+		bytes.push_back(value);
+	}
+
+	void appendPngChunk(std::vector<std::uint8_t>& file, const char* type, const std::vector<std::uint8_t>& data)
+	{
+		appendBigEndian(file, data.size());
+		const auto typeStart = file.size();
+		file.insert(std::end(file), type, type + 4);
+		file.insert(std::end(file), std::begin(data), std::end(data));
+		appendBigEndian(file, crc32(0, file.data() + typeStart, file.size() - typeStart));
+	}
+
+	void rowOfPixels(const geometry::Grid2<raster::RGB>& image, int y, std::uint8_t* row)
+	{
+		for(int x = 0; x < image.width(); x++)
+		{
+			const auto pixel = image({x, y});
+			row[BYTES_PER_PIXEL * x] = pixel.r;
+			row[BYTES_PER_PIXEL * x + 1] = pixel.g;
+			row[BYTES_PER_PIXEL * x + 2] = pixel.b;
+		}
+	}
+
+	//The Sub filter only looks at the row being filtered, which keeps bands independent of one another
+	CompressedBand compressBand(const geometry::Grid2<raster::RGB>& image, int firstRow, int numberOfRows, bool isLastBand)
+	{
+		const int bytesPerRow = 1 + BYTES_PER_PIXEL * image.width();
+		std::vector<std::uint8_t> filteredRows(bytesPerRow * numberOfRows);
+		std::vector<std::uint8_t> pixels(BYTES_PER_PIXEL * image.width());
+		for(int i = 0; i < numberOfRows; i++)
+		{
+			rowOfPixels(image, firstRow + i, pixels.data());
+			std::uint8_t* filteredRow = &filteredRows[i * bytesPerRow];
+			filteredRow[0] = PNG_SUB_FILTER;
+			for(int j = 0; j < static_cast<int>(pixels.size()); j++)
+			{
+				const std::uint8_t left = j >= BYTES_PER_PIXEL ? pixels[j - BYTES_PER_PIXEL] : 0;
+				filteredRow[1 + j] = pixels[j] - left;
+			}
+		}
+
+		CompressedBand band;
+		band.lengthOfRows = filteredRows.size();
+		band.adler32OfRows = adler32(adler32(0, NULL, 0), filteredRows.data(), filteredRows.size());
+		band.succeeded = false;
+
+		//A raw deflate stream (negative window bits) has no zlib header or checksum of its own, so bands can be
+		//concatenated. Sync flushing ends every band but the last on a byte boundary without ending the stream.
+		z_stream stream = {};
+		if(deflateInit2(&stream, COMPRESSION_LEVEL, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+		{
+			return band;
+		}
+		band.deflatedData.resize(deflateBound(&stream, filteredRows.size()) + 16);
+		stream.next_in = filteredRows.data();
+		stream.avail_in = filteredRows.size();
+		stream.next_out = band.deflatedData.data();
+		stream.avail_out = band.deflatedData.size();
+		const int result = deflate(&stream, isLastBand ? Z_FINISH : Z_SYNC_FLUSH);
+		band.succeeded = (isLastBand ? result == Z_STREAM_END : result == Z_OK) && stream.avail_in == 0;
+		band.deflatedData.resize(stream.total_out);
+		deflateEnd(&stream);
+		return band;
+	}
+
+	bool writeBytes(const std::string& fileName, const std::vector<std::uint8_t>& header, const std::vector<std::uint8_t>& body)
+	{
+		FILE* file = std::fopen(fileName.c_str(), "wb");
+		if(file == NULL)
+		{
+			return false;
+		}
+		bool succeeded = std::fwrite(header.data(), 1, header.size(), file) == header.size()
+			&& std::fwrite(body.data(), 1, body.size(), file) == body.size();
+		succeeded = std::fclose(file) == 0 && succeeded;
+		return succeeded;
+	}
+
+	std::vector<std::uint8_t> pixelsOfImage(const geometry::Grid2<raster::RGB>& image)
+	{
+		const int bytesPerRow = BYTES_PER_PIXEL * image.width();
+		std::vector<std::uint8_t> pixels(bytesPerRow * image.height());
+		for(int y = 0; y < image.height(); y++)
+		{
+			rowOfPixels(image, y, &pixels[y * bytesPerRow]);
+		}
+		return pixels;
+	}
+}
+
+ImageFiles::Format ImageFiles::formatOfFileName(const std::string& fileName)
+{
+	const auto extension = extensionOf(fileName);
+	if(extension == "ppm")
+	{
+		return Format::PortablePixmap;
+	}
+	else if(extension == "raw" || extension == "rgb")
+	{
+		return Format::Raw;
+	}
+	else
+	{
+		return Format::Png;
+	}
+}
+
+bool ImageFiles::writeImage(const std::string& fileName, const geometry::Grid2<raster::RGB>& image, int numberOfThreads)
+{
+	switch(formatOfFileName(fileName))
+	{
+		case(Format::PortablePixmap):
+			return writePortablePixmap(fileName, image);
+		case(Format::Raw):
+			return writeRaw(fileName, image);
+		default:
+			return writePng(fileName, image, numberOfThreads);
+	}
+}
+
+bool ImageFiles::writePng(const std::string& fileName, const geometry::Grid2<raster::RGB>& image, int numberOfThreads)
+{
+	const int numberOfBands = std::max(1, (image.height() + ROWS_PER_BAND - 1) / ROWS_PER_BAND);
+	std::vector<CompressedBand> bands(numberOfBands);
+
+	std::atomic<int> nextBand(0);
+	auto compressRemainingBands = [&]()
+	{
+		for(int band = nextBand++; band < numberOfBands; band = nextBand++)
+		{
+			const int firstRow = band * ROWS_PER_BAND;
+			const int numberOfRows = std::min(ROWS_PER_BAND, image.height() - firstRow);
+			bands[band] = compressBand(image, firstRow, std::max(0, numberOfRows), band == numberOfBands - 1);
+		}
+	};
+
+	std::vector<std::thread> workers;
+	for(int i = 1; i < std::min(numberOfThreads, numberOfBands); i++)
+	{
+		workers.emplace_back(compressRemainingBands);
+	}
+	compressRemainingBands();
+	for(auto& worker : workers)
+	{
+		worker.join();
+	}
+
+	std::vector<std::uint8_t> compressedImage(std::begin(ZLIB_HEADER), std::end(ZLIB_HEADER));
+	uLong adler32OfImage = adler32(0, NULL, 0);
+	for(const auto& band : bands)
+	{
+		if(!band.succeeded)
+		{
+			return false;
+		}
+		compressedImage.insert(std::end(compressedImage), std::begin(band.deflatedData), std::end(band.deflatedData));
+		adler32OfImage = adler32_combine(adler32OfImage, band.adler32OfRows, band.lengthOfRows);
+	}
+	appendBigEndian(compressedImage, adler32OfImage);
+
+	std::vector<std::uint8_t> header;
+	appendBigEndian(header, image.width());
+	appendBigEndian(header, image.height());
+	//8 bits per channel, RGB, deflate, adaptive filtering, not interlaced
+	header.insert(std::end(header), {8, 2, 0, 0, 0});
+
+	std::vector<std::uint8_t> file(std::begin(PNG_SIGNATURE), std::end(PNG_SIGNATURE));
+	appendPngChunk(file, "IHDR", header);
+	appendPngChunk(file, "IDAT", compressedImage);
+	appendPngChunk(file, "IEND", {});
+	return writeBytes(fileName, {}, file);
+}
+
+bool ImageFiles::writePortablePixmap(const std::string& fileName, const geometry::Grid2<raster::RGB>& image)
+{
+	const std::string text = "P6\n" + std::to_string(image.width()) + " " + std::to_string(image.height()) + "\n255\n";
+	return writeBytes(fileName, std::vector<std::uint8_t>(std::begin(text), std::end(text)), pixelsOfImage(image));
+}
+
+bool ImageFiles::writeRaw(const std::string& fileName, const geometry::Grid2<raster::RGB>& image)
+{
+	return writeBytes(fileName, {}, pixelsOfImage(image));
+}
+
+bool ImageFiles::readPortablePixmap(const std::string& fileName, geometry::Grid2<raster::RGB>* image)
+{
+	std::ifstream file(fileName, std::ios::binary);
+	std::string magicNumber;
+	int width = 0;
+	int height = 0;
+	int maximumValue = 0;
+	file >> magicNumber >> width >> height >> maximumValue;
+	//A single whitespace character separates the header from the pixels
+	file.get();
+	if(!file || magicNumber != "P6" || width <= 0 || height <= 0 || maximumValue != 255)
+	{
+		return false;
+	}
+
+	std::vector<std::uint8_t> pixels(BYTES_PER_PIXEL * width * height);
+	if(!file.read(reinterpret_cast<char*>(pixels.data()), pixels.size()))
+	{
+		return false;
+	}
+
+	*image = geometry::Grid2<raster::RGB>(width, height);
+	for(int y = 0; y < height; y++)
+	{
+		for(int x = 0; x < width; x++)
+		{
+			const std::uint8_t* pixel = &pixels[BYTES_PER_PIXEL * (y * width + x)];
+			(*image)({x, y}) = raster::RGB{pixel[0], pixel[1], pixel[2]};
+		}
+	}
+	return true;
+}
\ No newline at end of file
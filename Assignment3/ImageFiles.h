@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string>
+#include <thread>
+
+namespace geometry
+{
+	template<typename T> class Grid2;
+}
+
+namespace raster
+{
+	struct RGB;
+}
+
+//Writes rendered images to disk, and reads back the uncompressed ones. The format is chosen by the extension of the file name:
+//	.ppm		binary portable pixmap, uncompressed
+//	.raw/.rgb	bare 8 bit RGB triples, row by row with no header, for piping into other tools
+//	otherwise	PNG, compressed on several threads at once
+//Rows are written in order of increasing y.
+namespace ImageFiles
+{
+	enum class Format
+	{
+		Png,
+		PortablePixmap,
+		Raw
+	};
+
+	Format formatOfFileName(const std::string& fileName);
+
+	bool writeImage(
+		const std::string& fileName,
+		const geometry::Grid2<raster::RGB>& image,
+		int numberOfThreads = std::thread::hardware_concurrency());
+
+	//Splits the image into bands of rows that are filtered and deflated independently, each ending on a byte
+	//boundary, and stitches the results into a single zlib stream. Costs a few bytes of output per band.
+	bool writePng(
+		const std::string& fileName,
+		const geometry::Grid2<raster::RGB>& image,
+		int numberOfThreads = std::thread::hardware_concurrency());
+	bool writePortablePixmap(const std::string& fileName, const geometry::Grid2<raster::RGB>& image);
+	bool writeRaw(const std::string& fileName, const geometry::Grid2<raster::RGB>& image);
+
+	//Only reads the binary, 8 bit flavour of the format, as written by writePortablePixmap()
+	bool readPortablePixmap(const std::string& fileName, geometry::Grid2<raster::RGB>* image);
+}
\ No newline at end of file
@@ -1,326 +1,689 @@
-#pragma once
-
-#include "assignmentSpecific/I_IntersectableShape.h"
-
-#include <cmath>
-#include <list>
-#include <optional>
-
-#include "assignmentSpecific/Ray.h"
-#include "assignmentSpecific/TriangleBasedShape.h"
-#include "glUtility/Vertex.h"
-#include "math/LinearMath.h"
-#include "math/Matrix.h"
-#include "math/Vector.h"
-#include "shapes/Sphere.h"
-
-namespace RayTracing
-{
-	const float CALCULATION_EPSILON= 1e-5;
-
-	template<typename UnderlyingShape>
-	class IntersectableShape : public I_IntersectableShape
-	{
-	public:
-		~IntersectableShape() = default;
-	};
-
-	template<>
-	class IntersectableShape<Shapes::Sphere<float>> : public I_IntersectableShape
-	{
-	public:
-		IntersectableShape(
-			const GLUtility::Colour<float>& colour,
-			bool surfaceIsReflective,
-			const Shapes::Sphere<float>& underlyingSphere);
-
-		GLUtility::Colour<float> colourOfShape() const override;
-		std::optional<MathTypes::Vector<3, float>> surfaceNormalAtPoint(const MathTypes::Vector<3, float>& point) const override;
-		bool surfaceIsReflective() const override;
-
-		std::optional<std::list<MathTypes::Vector<3, float>>> intersectionPoints(const Ray& ray) const override;
-		std::optional<MathTypes::Vector<3, float>> closestIntersectionPoint(const Ray& ray) const override;
-
-	private:
-		bool pointIsOnSurface(const MathTypes::Vector<3, float>& point) const;
-
-	private:
-		const GLUtility::Colour<float> colour_;
-		bool surfaceIsReflective_;
-		const Shapes::Sphere<float> underlyingSphere_;		
-	};
-
-	template<typename UnderlyingTriangleBasedShape>
-	class IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>> : public I_IntersectableShape
-	{
-	public:
-		IntersectableShape(
-			const GLUtility::Colour<float>& colour,
-			bool surfaceIsReflective,
-			const RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>& underlyingShape);
-
-		GLUtility::Colour<float> colourOfShape() const override;
-		std::optional<MathTypes::Vector<3, float>> surfaceNormalAtPoint(const MathTypes::Vector<3, float>& point) const override;
-		bool surfaceIsReflective() const override;
-
-		std::optional<std::list<MathTypes::Vector<3, float>>> intersectionPoints(const Ray& ray) const override;
-		std::optional<MathTypes::Vector<3, float>> closestIntersectionPoint(const Ray& ray) const override;
-
-	private:
-		const GLUtility::Colour<float> colour_;
-		bool surfaceIsReflective_;
-		const RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape> underlyingShape_;		
-	};
-}
-
-RayTracing::IntersectableShape<Shapes::Sphere<float>>::IntersectableShape(
-	const GLUtility::Colour<float>& colour,
-	bool surfaceIsReflective,
-	const Shapes::Sphere<float>& underlyingSphere)
-	: colour_(colour)
-	, surfaceIsReflective_(surfaceIsReflective)
-	, underlyingSphere_(underlyingSphere)
-{
-}
-
-template<typename UnderlyingTriangleBasedShape>
-RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::IntersectableShape(
-	const GLUtility::Colour<float>& colour,
-	bool surfaceIsReflective,
-	const RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>& underlyingShape)
-	: colour_(colour)
-	, surfaceIsReflective_(surfaceIsReflective)
-	, underlyingShape_(underlyingShape)
-{
-}
-
-std::optional<std::list<MathTypes::Vector<3, float>>> 
-RayTracing::IntersectableShape<Shapes::Sphere<float>>::intersectionPoints(const Ray& ray) const
-{
-	//Andrew mentioned lack of precision of quadratic formula with floating point numbers in tutorial.
-	//The quadratic formula code below is inspired by discussion in the following link
-	//https://math.stackexchange.com/questions/311382/solving-a-quadratic-equation-with-precision-when-using-floating-point-variables
-
-	auto centreToOrigin = ray.origin() - underlyingSphere_.centre();
-	float a = LinearMath::dotProduct(ray.direction(), ray.direction());
-	float b = 2 * LinearMath::dotProduct(centreToOrigin, ray.direction());
-	float c = LinearMath::dotProduct(centreToOrigin, centreToOrigin) 
-					- (underlyingSphere_.radius() * underlyingSphere_.radius());
-	float discriminant = b*b - 4*a*c;
-	discriminant = std::abs(discriminant) > CALCULATION_EPSILON ? discriminant : 0;
-
-	if (a == 0)
-	{
-		return std::nullopt;
-	}
-	else if (discriminant > 0)
-	{
-		float firstRoot = b < 0 ? 
-			((-b + std::sqrt(discriminant)) / 2*a) : ((-b - std::sqrt(discriminant)) / 2*a);
-		float secondRoot = c/(a*firstRoot);
-
-		std::list<MathTypes::Vector<3, float>> intersectionPoints;
-		if(firstRoot > 0)
-		{
-			intersectionPoints.push_back(ray.pointAlongLine(firstRoot));
-		}
-		if(secondRoot > 0)
-		{
-			intersectionPoints.push_back(ray.pointAlongLine(secondRoot));
-		}
-		if(intersectionPoints.size() > 0)
-		{
-			return intersectionPoints;
-		}
-	}
-	else if(discriminant == 0)
-	{
-		float distanceFromOrigin = -b / (2*a);
-		if(distanceFromOrigin > 0)
-		{
-			return std::list<MathTypes::Vector<3, float>>({ray.pointAlongLine(-b / (2*a))});
-		}
-	}
-
-	return std::nullopt;
-}
-
-std::optional<MathTypes::Vector<3, float>> 
-RayTracing::IntersectableShape<Shapes::Sphere<float>>::closestIntersectionPoint(const Ray& ray) const
-{
-	auto intersections = intersectionPoints(ray);
-	if(!intersections)
-	{
-		return std::nullopt;
-	}
-	else
-	{
-		intersections->sort([=](const MathTypes::Vector<3, float>& a, const MathTypes::Vector<3, float>& b)
-			{
-				float distanceFromAToOriginOfRay = LinearMath::distanceBetweenPoints(a, ray.origin());
-				float distanceFromBToOriginOfRay = LinearMath::distanceBetweenPoints(b, ray.origin());
-				if(distanceFromAToOriginOfRay < distanceFromBToOriginOfRay)
-				{
-					return distanceFromAToOriginOfRay;
-				}
-				else
-				{
-					return distanceFromBToOriginOfRay;
-				}
-			});
-		return intersections->front();
-	}
-}
-
-GLUtility::Colour<float> RayTracing::IntersectableShape<Shapes::Sphere<float>>::colourOfShape() const
-{
-	return colour_;
-}
-
-bool RayTracing::IntersectableShape<Shapes::Sphere<float>>::surfaceIsReflective() const
-{
-	return surfaceIsReflective_;
-}
-
-std::optional<MathTypes::Vector<3, float>> RayTracing::IntersectableShape<Shapes::Sphere<float>>::surfaceNormalAtPoint(
-	const MathTypes::Vector<3, float>& point) const 
-{
-	if(pointIsOnSurface(point))
-	{
-		return (point -  underlyingSphere_.centre()).normalized();
-	}
-	else
-	{
-		return std::nullopt;
-	}
-}
-
-bool RayTracing::IntersectableShape<Shapes::Sphere<float>>::pointIsOnSurface(
-	const MathTypes::Vector<3, float>& point) const
-{
-	if(std::abs((point -  underlyingSphere_.centre()).magnitude() - underlyingSphere_.radius()) < CALCULATION_EPSILON)
-	{
-		return true;
-	}
-	else
-	{
-		return false;
-	}
-}
-
-template<typename UnderlyingTriangleBasedShape>
-std::optional<std::list<MathTypes::Vector<3, float>>> 
-RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::intersectionPoints(
-	const Ray& ray) const
-{
-	std::list<MathTypes::Vector<3, float>> intersections;
-	for(const auto& triangle : underlyingShape_.underlyingTriangles())
-	{
-		auto ba = triangle.vertices()[0] - triangle.vertices()[1];
-		auto ca = triangle.vertices()[0] - triangle.vertices()[2];
-		auto oa = triangle.vertices()[0] - ray.origin();
-		auto d = ray.direction();
-
-		MathTypes::Matrix<3, 3, float> A({
-			{d.xValue(), ba.xValue(), ca.xValue()},
-			{d.yValue(), ba.yValue(), ca.yValue()},
-			{d.zValue(), ba.zValue(), ca.zValue()}
-		});
-		auto B = static_cast<MathTypes::Matrix<3, 1, float>>(oa).jthColumn(0);
-
-		float beta = LinearMath::determinant(A.withColumnReplaced(1, B)) / LinearMath::determinant(A);
-		float gamma = LinearMath::determinant(A.withColumnReplaced(2, B)) / LinearMath::determinant(A);
-
-		if(beta >= 0 && gamma >= 0 && ((beta + gamma) >= 0) && ((beta + gamma) <= 1))
-		{
-			float t = LinearMath::determinant(A.withColumnReplaced(0, B)) / LinearMath::determinant(A);
-			if(t > 0)
-			{
-				intersections.push_back(ray.pointAlongLine(t));
-			}
-		}
-	}
-
-	if(intersections.size() == 0)
-	{
-		return std::nullopt;
-	}
-	else
-	{
-		return intersections;
-	}
-}
-
-template<typename UnderlyingTriangleBasedShape>
-std::optional<MathTypes::Vector<3, float>> 
-RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::closestIntersectionPoint(
-	const Ray& ray) const
-{
-	auto intersections = intersectionPoints(ray);
-	if(!intersections)
-	{
-		return std::nullopt;
-	}
-	else
-	{
-		intersections->sort([=](const MathTypes::Vector<3, float>& a, const MathTypes::Vector<3, float>& b)
-			{
-				float distanceFromAToOriginOfRay = LinearMath::distanceBetweenPoints(a, ray.origin());
-				float distanceFromBToOriginOfRay = LinearMath::distanceBetweenPoints(b, ray.origin());
-				if(distanceFromAToOriginOfRay < distanceFromBToOriginOfRay)
-				{
-					return distanceFromAToOriginOfRay;
-				}
-				else
-				{
-					return distanceFromBToOriginOfRay;
-				}
-			});
-		return intersections->front();
-	}
-}
-
-template<typename UnderlyingTriangleBasedShape>
-GLUtility::Colour<float>
-RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::colourOfShape() const
-{
-	return colour_;
-}
-
-template<typename UnderlyingTriangleBasedShape>
-bool
-RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::surfaceIsReflective() const
-{
-	return surfaceIsReflective_;
-}
-
-template<typename UnderlyingTriangleBasedShape>
-std::optional<MathTypes::Vector<3, float>>
-RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::surfaceNormalAtPoint(
-	const MathTypes::Vector<3, float>& point) const
-{
-	for(const auto& triangle : underlyingShape_.underlyingTriangles())
-	{
-		auto a = triangle.vertices()[0];
-		auto ab = triangle.vertices()[1] - triangle.vertices()[0];
-		auto ac = triangle.vertices()[2] - triangle.vertices()[0];
-
-		MathTypes::Matrix<3, 3, float> A({
-			{a.xValue(), ab.xValue(), ac.xValue()},
-			{a.yValue(), ab.yValue(), ac.yValue()},
-			{a.zValue(), ab.zValue(), ac.zValue()}
-		});
-		auto B = static_cast<MathTypes::Matrix<3, 1, float>>(point).jthColumn(0);
-
-		float beta = LinearMath::determinant(A.withColumnReplaced(1, B)) / LinearMath::determinant(A);
-		float gamma = LinearMath::determinant(A.withColumnReplaced(2, B)) / LinearMath::determinant(A);
-
-		if(beta >= 0 && gamma >= 0 && ((beta + gamma) >= 0) && ((beta + gamma) <= 1))
-		{
-			auto bc = triangle.vertices()[2] - triangle.vertices()[1];
-			return LinearMath::crossProduct(ab, bc).normalized();
-		}
-	}	
-
-	return std::nullopt;
+#pragma once
+
+#include "assignmentSpecific/I_IntersectableShape.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <list>
+#include <optional>
+#include <vector>
+
+#include "assignmentSpecific/BoundingBox.h"
+#include "assignmentSpecific/MengerSpongeTraversal.h"
+#include "assignmentSpecific/Ray.h"
+#include "assignmentSpecific/SphereGrid.h"
+#include "assignmentSpecific/TriangleBasedShape.h"
+#include "glUtility/Vertex.h"
+#include "math/LinearMath.h"
+#include "math/Matrix.h"
+#include "math/Vector.h"
+#include "shapes/MengerSponge.h"
+#include "shapes/Sphere.h"
+#include "shapes/SphereCloud.h"
+
+namespace RayTracing
+{
+	const float CALCULATION_EPSILON= 1e-5;
+
+	template<typename UnderlyingShape>
+	class IntersectableShape : public I_IntersectableShape
+	{
+	public:
+		~IntersectableShape() = default;
+	};
+
+	//The specialisations are final so that code which knows the type of a shape, such as StaticScene, calls
+	//them directly and can have them inlined
+	template<>
+	class IntersectableShape<Shapes::Sphere<float>> final : public I_IntersectableShape
+	{
+	public:
+		IntersectableShape(
+			const GLUtility::Colour<float>& colour,
+			bool surfaceIsReflective,
+			const Shapes::Sphere<float>& underlyingSphere);
+
+		GLUtility::Colour<float> colourOfShape() const override;
+		std::optional<MathTypes::Vector<3, float>> surfaceNormalAtPoint(const MathTypes::Vector<3, float>& point) const override;
+		bool surfaceIsReflective() const override;
+
+		std::optional<std::list<MathTypes::Vector<3, float>>> intersectionPoints(const Ray& ray) const override;
+		std::optional<MathTypes::Vector<3, float>> closestIntersectionPoint(const Ray& ray) const override;
+
+		BoundingBox boundingBox() const override;
+		void transform(const MathTypes::Matrix<4, 4, float>& transformationMatrix) override;
+
+		//Distance along the ray to the closest intersection, without building a list of every intersection
+		std::optional<float> closestIntersectionDistance(const Ray& ray) const;
+
+	private:
+		bool pointIsOnSurface(const MathTypes::Vector<3, float>& point) const;
+		//Fills distances with up to two distances along the ray, in front of its origin, and returns how many
+		int intersectionDistances(const Ray& ray, float* distances) const;
+
+	private:
+		const GLUtility::Colour<float> colour_;
+		bool surfaceIsReflective_;
+		Shapes::Sphere<float> underlyingSphere_;		
+	};
+
+	//All spheres of a cloud share one colour, and the cloud is a single object as far as the rest of the ray
+	//tracer is concerned
+	template<>
+	class IntersectableShape<Shapes::SphereCloud<float>> final : public I_IntersectableShape
+	{
+	public:
+		IntersectableShape(
+			const GLUtility::Colour<float>& colour,
+			bool surfaceIsReflective,
+			const Shapes::SphereCloud<float>& underlyingSpheres);
+
+		GLUtility::Colour<float> colourOfShape() const override;
+		std::optional<MathTypes::Vector<3, float>> surfaceNormalAtPoint(const MathTypes::Vector<3, float>& point) const override;
+		bool surfaceIsReflective() const override;
+
+		//Only reports the closest intersection. Listing every sphere along the ray would defeat the grid.
+		std::optional<std::list<MathTypes::Vector<3, float>>> intersectionPoints(const Ray& ray) const override;
+		std::optional<MathTypes::Vector<3, float>> closestIntersectionPoint(const Ray& ray) const override;
+
+		BoundingBox boundingBox() const override;
+		void transform(const MathTypes::Matrix<4, 4, float>& transformationMatrix) override;
+
+	private:
+		const GLUtility::Colour<float> colour_;
+		bool surfaceIsReflective_;
+		SphereGrid underlyingSpheres_;
+	};
+
+	//Intersected analytically, so sponges of any level of recursion cost the same memory as a single cube
+	template<>
+	class IntersectableShape<Shapes::MengerSponge<float>> final : public I_IntersectableShape
+	{
+	public:
+		IntersectableShape(
+			const GLUtility::Colour<float>& colour,
+			bool surfaceIsReflective,
+			const Shapes::MengerSponge<float>& underlyingSponge);
+
+		GLUtility::Colour<float> colourOfShape() const override;
+		std::optional<MathTypes::Vector<3, float>> surfaceNormalAtPoint(const MathTypes::Vector<3, float>& point) const override;
+		bool surfaceIsReflective() const override;
+
+		//Only reports the closest intersection
+		std::optional<std::list<MathTypes::Vector<3, float>>> intersectionPoints(const Ray& ray) const override;
+		std::optional<MathTypes::Vector<3, float>> closestIntersectionPoint(const Ray& ray) const override;
+
+		BoundingBox boundingBox() const override;
+		void transform(const MathTypes::Matrix<4, 4, float>& transformationMatrix) override;
+
+		//Distance along the ray to the closest intersection, without building a list of every intersection
+		std::optional<float> closestIntersectionDistance(const Ray& ray) const;
+
+	private:
+		const GLUtility::Colour<float> colour_;
+		bool surfaceIsReflective_;
+		MengerSpongeTraversal underlyingSponge_;
+	};
+
+	template<typename UnderlyingTriangleBasedShape>
+	class IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>> final : public I_IntersectableShape
+	{
+	public:
+		IntersectableShape(
+			const GLUtility::Colour<float>& colour,
+			bool surfaceIsReflective,
+			const RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>& underlyingShape);
+
+		GLUtility::Colour<float> colourOfShape() const override;
+		std::optional<MathTypes::Vector<3, float>> surfaceNormalAtPoint(const MathTypes::Vector<3, float>& point) const override;
+		bool surfaceIsReflective() const override;
+
+		std::optional<std::list<MathTypes::Vector<3, float>>> intersectionPoints(const Ray& ray) const override;
+		std::optional<MathTypes::Vector<3, float>> closestIntersectionPoint(const Ray& ray) const override;
+
+		BoundingBox boundingBox() const override;
+		void transform(const MathTypes::Matrix<4, 4, float>& transformationMatrix) override;
+
+		//Distance along the ray to the closest intersection, without building a list of every intersection
+		std::optional<float> closestIntersectionDistance(const Ray& ray) const;
+
+	private:
+		//The vertices and edges of one underlying triangle, kept so that rays are tested without building the
+		//triangles again
+		struct TriangleEdges
+		{
+			std::array<MathTypes::Vector<3, float>, 3> vertices;
+			MathTypes::Vector<3, float> firstToSecond;
+			MathTypes::Vector<3, float> firstToThird;
+			MathTypes::Vector<3, float> secondToThird;
+		};
+
+		static std::vector<TriangleEdges> edgesOfTriangles(
+			const RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>& shape);
+		static std::optional<float> intersectionDistanceWithTriangle(const TriangleEdges& triangle, const Ray& ray);
+
+	private:
+		const GLUtility::Colour<float> colour_;
+		bool surfaceIsReflective_;
+		RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape> underlyingShape_;		
+		std::vector<TriangleEdges> triangles_;
+	};
+}
+
+RayTracing::IntersectableShape<Shapes::Sphere<float>>::IntersectableShape(
+	const GLUtility::Colour<float>& colour,
+	bool surfaceIsReflective,
+	const Shapes::Sphere<float>& underlyingSphere)
+	: colour_(colour)
+	, surfaceIsReflective_(surfaceIsReflective)
+	, underlyingSphere_(underlyingSphere)
+{
+}
+
+RayTracing::IntersectableShape<Shapes::SphereCloud<float>>::IntersectableShape(
+	const GLUtility::Colour<float>& colour,
+	bool surfaceIsReflective,
+	const Shapes::SphereCloud<float>& underlyingSpheres)
+	: colour_(colour)
+	, surfaceIsReflective_(surfaceIsReflective)
+	, underlyingSpheres_(underlyingSpheres)
+{
+}
+
+RayTracing::IntersectableShape<Shapes::MengerSponge<float>>::IntersectableShape(
+	const GLUtility::Colour<float>& colour,
+	bool surfaceIsReflective,
+	const Shapes::MengerSponge<float>& underlyingSponge)
+	: colour_(colour)
+	, surfaceIsReflective_(surfaceIsReflective)
+	, underlyingSponge_(underlyingSponge)
+{
+}
+
+template<typename UnderlyingTriangleBasedShape>
+RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::IntersectableShape(
+	const GLUtility::Colour<float>& colour,
+	bool surfaceIsReflective,
+	const RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>& underlyingShape)
+	: colour_(colour)
+	, surfaceIsReflective_(surfaceIsReflective)
+	, underlyingShape_(underlyingShape)
+	, triangles_(edgesOfTriangles(underlyingShape))
+{
+}
+
+std::optional<std::list<MathTypes::Vector<3, float>>> 
+RayTracing::IntersectableShape<Shapes::Sphere<float>>::intersectionPoints(const Ray& ray) const
+{
+	float distances[2];
+	const int numberOfIntersections = intersectionDistances(ray, distances);
+	if(numberOfIntersections == 0)
+	{
+		return std::nullopt;
+	}
+
+	std::list<MathTypes::Vector<3, float>> intersectionPoints;
+	for(int i = 0; i < numberOfIntersections; i++)
+	{
+		intersectionPoints.push_back(ray.pointAlongLine(distances[i]));
+	}
+	return intersectionPoints;
+}
+
+std::optional<float> RayTracing::IntersectableShape<Shapes::Sphere<float>>::closestIntersectionDistance(const Ray& ray) const
+{
+	float distances[2];
+	const int numberOfIntersections = intersectionDistances(ray, distances);
+	if(numberOfIntersections == 0)
+	{
+		return std::nullopt;
+	}
+	return numberOfIntersections == 1 ? distances[0] : std::min(distances[0], distances[1]);
+}
+
+int RayTracing::IntersectableShape<Shapes::Sphere<float>>::intersectionDistances(const Ray& ray, float* distances) const
+{
+	//Andrew mentioned lack of precision of quadratic formula with floating point numbers in tutorial.
+	//The quadratic formula code below is inspired by discussion in the following link
+	//https://math.stackexchange.com/questions/311382/solving-a-quadratic-equation-with-precision-when-using-floating-point-variables
+
+	auto centreToOrigin = ray.origin() - underlyingSphere_.centre();
+	float a = LinearMath::dotProduct(ray.direction(), ray.direction());
+	float b = 2 * LinearMath::dotProduct(centreToOrigin, ray.direction());
+	float c = LinearMath::dotProduct(centreToOrigin, centreToOrigin) 
+					- (underlyingSphere_.radius() * underlyingSphere_.radius());
+	float discriminant = b*b - 4*a*c;
+	discriminant = std::abs(discriminant) > CALCULATION_EPSILON ? discriminant : 0;
+
+	int numberOfIntersections = 0;
+	if (a == 0)
+	{
+		return 0;
+	}
+	else if (discriminant > 0)
+	{
+		float firstRoot = b < 0 ? 
+			((-b + std::sqrt(discriminant)) / (2*a)) : ((-b - std::sqrt(discriminant)) / (2*a));
+		float secondRoot = c/(a*firstRoot);
+
+		if(firstRoot > 0)
+		{
+			distances[numberOfIntersections++] = firstRoot;
+		}
+		if(secondRoot > 0)
+		{
+			distances[numberOfIntersections++] = secondRoot;
+		}
+	}
+	else if(discriminant == 0)
+	{
+		float distanceFromOrigin = -b / (2*a);
+		if(distanceFromOrigin > 0)
+		{
+			distances[numberOfIntersections++] = distanceFromOrigin;
+		}
+	}
+
+	return numberOfIntersections;
+}
+
+std::optional<MathTypes::Vector<3, float>> 
+RayTracing::IntersectableShape<Shapes::Sphere<float>>::closestIntersectionPoint(const Ray& ray) const
+{
+	auto intersections = intersectionPoints(ray);
+	if(!intersections)
+	{
+		return std::nullopt;
+	}
+	else
+	{
+		intersections->sort([=](const MathTypes::Vector<3, float>& a, const MathTypes::Vector<3, float>& b)
+			{
+				float distanceFromAToOriginOfRay = LinearMath::distanceBetweenPoints(a, ray.origin());
+				float distanceFromBToOriginOfRay = LinearMath::distanceBetweenPoints(b, ray.origin());
+				if(distanceFromAToOriginOfRay < distanceFromBToOriginOfRay)
+				{
+					return distanceFromAToOriginOfRay;
+				}
+				else
+				{
+					return distanceFromBToOriginOfRay;
+				}
+			});
+		return intersections->front();
+	}
+}
+
+GLUtility::Colour<float> RayTracing::IntersectableShape<Shapes::Sphere<float>>::colourOfShape() const
+{
+	return colour_;
+}
+
+bool RayTracing::IntersectableShape<Shapes::Sphere<float>>::surfaceIsReflective() const
+{
+	return surfaceIsReflective_;
+}
+
+std::optional<MathTypes::Vector<3, float>> RayTracing::IntersectableShape<Shapes::Sphere<float>>::surfaceNormalAtPoint(
+	const MathTypes::Vector<3, float>& point) const 
+{
+	if(pointIsOnSurface(point))
+	{
+		return (point -  underlyingSphere_.centre()).normalized();
+	}
+	else
+	{
+		return std::nullopt;
+	}
+}
+
+bool RayTracing::IntersectableShape<Shapes::Sphere<float>>::pointIsOnSurface(
+	const MathTypes::Vector<3, float>& point) const
+{
+	if(std::abs((point -  underlyingSphere_.centre()).magnitude() - underlyingSphere_.radius()) < CALCULATION_EPSILON)
+	{
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+RayTracing::BoundingBox RayTracing::IntersectableShape<Shapes::Sphere<float>>::boundingBox() const
+{
+	const float radius = underlyingSphere_.radius();
+	const MathTypes::Vector<3, float> radiusInEachDirection(radius, radius, radius);
+
+	return BoundingBox(underlyingSphere_.centre() - radiusInEachDirection, underlyingSphere_.centre() + radiusInEachDirection);
+}
+
+void RayTracing::IntersectableShape<Shapes::Sphere<float>>::transform(
+	const MathTypes::Matrix<4, 4, float>& transformationMatrix)
+{
+	underlyingSphere_.transform(transformationMatrix);
+}
+
+std::optional<std::list<MathTypes::Vector<3, float>>> 
+RayTracing::IntersectableShape<Shapes::SphereCloud<float>>::intersectionPoints(const Ray& ray) const
+{
+	auto closestIntersection = closestIntersectionPoint(ray);
+	if(closestIntersection)
+	{
+		return std::list<MathTypes::Vector<3, float>>({*closestIntersection});
+	}
+	else
+	{
+		return std::nullopt;
+	}
+}
+
+std::optional<MathTypes::Vector<3, float>> 
+RayTracing::IntersectableShape<Shapes::SphereCloud<float>>::closestIntersectionPoint(const Ray& ray) const
+{
+	int sphereIndex;
+	auto distanceAlongRay = underlyingSpheres_.closestIntersection(ray, &sphereIndex);
+	if(distanceAlongRay)
+	{
+		return ray.pointAlongLine(*distanceAlongRay);
+	}
+	else
+	{
+		return std::nullopt;
+	}
+}
+
+GLUtility::Colour<float> RayTracing::IntersectableShape<Shapes::SphereCloud<float>>::colourOfShape() const
+{
+	return colour_;
+}
+
+bool RayTracing::IntersectableShape<Shapes::SphereCloud<float>>::surfaceIsReflective() const
+{
+	return surfaceIsReflective_;
+}
+
+std::optional<MathTypes::Vector<3, float>> RayTracing::IntersectableShape<Shapes::SphereCloud<float>>::surfaceNormalAtPoint(
+	const MathTypes::Vector<3, float>& point) const 
+{
+	auto sphereIndex = underlyingSpheres_.sphereNearestToSurfacePoint(point);
+	if(sphereIndex)
+	{
+		return (point - underlyingSpheres_.spheres().centre(*sphereIndex)).normalized();
+	}
+	else
+	{
+		return std::nullopt;
+	}
+}
+
+RayTracing::BoundingBox RayTracing::IntersectableShape<Shapes::SphereCloud<float>>::boundingBox() const
+{
+	return underlyingSpheres_.boundingBox();
+}
+
+void RayTracing::IntersectableShape<Shapes::SphereCloud<float>>::transform(
+	const MathTypes::Matrix<4, 4, float>& transformationMatrix)
+{
+	underlyingSpheres_.transform(transformationMatrix);
+}
+
+std::optional<std::list<MathTypes::Vector<3, float>>> 
+RayTracing::IntersectableShape<Shapes::MengerSponge<float>>::intersectionPoints(const Ray& ray) const
+{
+	auto closestIntersection = closestIntersectionPoint(ray);
+	if(closestIntersection)
+	{
+		return std::list<MathTypes::Vector<3, float>>({*closestIntersection});
+	}
+	else
+	{
+		return std::nullopt;
+	}
+}
+
+std::optional<MathTypes::Vector<3, float>> 
+RayTracing::IntersectableShape<Shapes::MengerSponge<float>>::closestIntersectionPoint(const Ray& ray) const
+{
+	auto distanceAlongRay = closestIntersectionDistance(ray);
+	if(distanceAlongRay)
+	{
+		return ray.pointAlongLine(*distanceAlongRay);
+	}
+	else
+	{
+		return std::nullopt;
+	}
+}
+
+std::optional<float> RayTracing::IntersectableShape<Shapes::MengerSponge<float>>::closestIntersectionDistance(const Ray& ray) const
+{
+	return underlyingSponge_.closestIntersection(ray);
+}
+
+GLUtility::Colour<float> RayTracing::IntersectableShape<Shapes::MengerSponge<float>>::colourOfShape() const
+{
+	return colour_;
+}
+
+bool RayTracing::IntersectableShape<Shapes::MengerSponge<float>>::surfaceIsReflective() const
+{
+	return surfaceIsReflective_;
+}
+
+std::optional<MathTypes::Vector<3, float>> RayTracing::IntersectableShape<Shapes::MengerSponge<float>>::surfaceNormalAtPoint(
+	const MathTypes::Vector<3, float>& point) const 
+{
+	return underlyingSponge_.surfaceNormalAtPoint(point);
+}
+
+RayTracing::BoundingBox RayTracing::IntersectableShape<Shapes::MengerSponge<float>>::boundingBox() const
+{
+	return underlyingSponge_.boundingBox();
+}
+
+void RayTracing::IntersectableShape<Shapes::MengerSponge<float>>::transform(
+	const MathTypes::Matrix<4, 4, float>& transformationMatrix)
+{
+	underlyingSponge_.transform(transformationMatrix);
+}
+
+template<typename UnderlyingTriangleBasedShape>
+std::optional<std::list<MathTypes::Vector<3, float>>> 
+RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::intersectionPoints(
+	const Ray& ray) const
+{
+	std::list<MathTypes::Vector<3, float>> intersections;
+	for(const auto& triangle : triangles_)
+	{
+		auto distance = intersectionDistanceWithTriangle(triangle, ray);
+		if(distance)
+		{
+			intersections.push_back(ray.pointAlongLine(*distance));
+		}
+	}
+
+	if(intersections.size() == 0)
+	{
+		return std::nullopt;
+	}
+	else
+	{
+		return intersections;
+	}
+}
+
+template<typename UnderlyingTriangleBasedShape>
+std::optional<float>
+RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::closestIntersectionDistance(
+	const Ray& ray) const
+{
+	std::optional<float> closestDistance;
+	for(const auto& triangle : triangles_)
+	{
+		auto distance = intersectionDistanceWithTriangle(triangle, ray);
+		if(distance && (!closestDistance || *distance < *closestDistance))
+		{
+			closestDistance = distance;
+		}
+	}
+	return closestDistance;
+}
+
+template<typename UnderlyingTriangleBasedShape>
+std::vector<typename RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::TriangleEdges>
+RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::edgesOfTriangles(
+	const RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>& shape)
+{
+	std::vector<TriangleEdges> triangles;
+	for(const auto& triangle : shape.underlyingTriangles())
+	{
+		const auto vertices = triangle.vertices();
+		triangles.push_back(TriangleEdges{
+			{vertices[0], vertices[1], vertices[2]},
+			vertices[1] - vertices[0],
+			vertices[2] - vertices[0],
+			vertices[2] - vertices[1]});
+	}
+	return triangles;
+}
+
+//Moller-Trumbore: solves origin + t*direction = a + beta*ab + gamma*ac with cross products, which share their
+//work between beta, gamma and t instead of taking a determinant for each
+template<typename UnderlyingTriangleBasedShape>
+std::optional<float>
+RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::intersectionDistanceWithTriangle(
+	const TriangleEdges& triangle,
+	const Ray& ray)
+{
+	const auto& ab = triangle.firstToSecond;
+	const auto& ac = triangle.firstToThird;
+	auto d = ray.direction();
+
+	auto p = LinearMath::crossProduct(d, ac);
+	float determinant = LinearMath::dotProduct(ab, p);
+	if(determinant == 0)
+	{
+		//The ray is parallel to the triangle
+		return std::nullopt;
+	}
+	float inverseOfDeterminant = 1 / determinant;
+
+	auto ao = ray.origin() - triangle.vertices[0];
+	float beta = LinearMath::dotProduct(ao, p) * inverseOfDeterminant;
+	if(beta < 0 || beta > 1)
+	{
+		return std::nullopt;
+	}
+
+	auto q = LinearMath::crossProduct(ao, ab);
+	float gamma = LinearMath::dotProduct(d, q) * inverseOfDeterminant;
+	if(gamma < 0 || (beta + gamma) > 1)
+	{
+		return std::nullopt;
+	}
+
+	float t = LinearMath::dotProduct(ac, q) * inverseOfDeterminant;
+	if(t > 0)
+	{
+		return t;
+	}
+	return std::nullopt;
+}
+
+template<typename UnderlyingTriangleBasedShape>
+std::optional<MathTypes::Vector<3, float>> 
+RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::closestIntersectionPoint(
+	const Ray& ray) const
+{
+	auto intersections = intersectionPoints(ray);
+	if(!intersections)
+	{
+		return std::nullopt;
+	}
+	else
+	{
+		intersections->sort([=](const MathTypes::Vector<3, float>& a, const MathTypes::Vector<3, float>& b)
+			{
+				float distanceFromAToOriginOfRay = LinearMath::distanceBetweenPoints(a, ray.origin());
+				float distanceFromBToOriginOfRay = LinearMath::distanceBetweenPoints(b, ray.origin());
+				if(distanceFromAToOriginOfRay < distanceFromBToOriginOfRay)
+				{
+					return distanceFromAToOriginOfRay;
+				}
+				else
+				{
+					return distanceFromBToOriginOfRay;
+				}
+			});
+		return intersections->front();
+	}
+}
+
+template<typename UnderlyingTriangleBasedShape>
+GLUtility::Colour<float>
+RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::colourOfShape() const
+{
+	return colour_;
+}
+
+template<typename UnderlyingTriangleBasedShape>
+bool
+RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::surfaceIsReflective() const
+{
+	return surfaceIsReflective_;
+}
+
+template<typename UnderlyingTriangleBasedShape>
+std::optional<MathTypes::Vector<3, float>>
+RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::surfaceNormalAtPoint(
+	const MathTypes::Vector<3, float>& point) const
+{
+	for(const auto& triangle : triangles_)
+	{
+		const auto& a = triangle.vertices[0];
+		const auto& ab = triangle.firstToSecond;
+		const auto& ac = triangle.firstToThird;
+
+		MathTypes::Matrix<3, 3, float> A({
+			{a.xValue(), ab.xValue(), ac.xValue()},
+			{a.yValue(), ab.yValue(), ac.yValue()},
+			{a.zValue(), ab.zValue(), ac.zValue()}
+		});
+		auto B = static_cast<MathTypes::Matrix<3, 1, float>>(point).jthColumn(0);
+
+		float beta = LinearMath::determinant(A.withColumnReplaced(1, B)) / LinearMath::determinant(A);
+		float gamma = LinearMath::determinant(A.withColumnReplaced(2, B)) / LinearMath::determinant(A);
+
+		if(beta >= 0 && gamma >= 0 && ((beta + gamma) >= 0) && ((beta + gamma) <= 1))
+		{
+			return LinearMath::crossProduct(ab, triangle.secondToThird).normalized();
+		}
+	}	
+
+	return std::nullopt;
+}
+
+template<typename UnderlyingTriangleBasedShape>
+RayTracing::BoundingBox
+RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::boundingBox() const
+{
+	auto bounds = BoundingBox::emptyBox();
+	for(const auto& triangle : triangles_)
+	{
+		for(const auto& vertex : triangle.vertices)
+		{
+			bounds = bounds.enclosing(vertex);
+		}
+	}
+	return bounds;
+}
+
+template<typename UnderlyingTriangleBasedShape>
+void RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<UnderlyingTriangleBasedShape>>::transform(
+	const MathTypes::Matrix<4, 4, float>& transformationMatrix)
+{
+	underlyingShape_.transform(transformationMatrix);
+	triangles_ = edgesOfTriangles(underlyingShape_);
 }
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include "assignmentSpecific/IrradianceCache.h"
+
+#include <cmath>
+#include <cstdint>
+
+namespace
+{
+	bool pointsAreEqual(const MathTypes::Vector<3, float>& a, const MathTypes::Vector<3, float>& b)
+	{
+		return a.xValue() == b.xValue() && a.yValue() == b.yValue() && a.zValue() == b.zValue();
+	}
+}
+
+RayTracing::IrradianceCache::IrradianceCache(float cellSize)
+	: cellSize_(cellSize)
+{
+}
+
+std::optional<RayTracing::IrradianceCache::Entry> RayTracing::IrradianceCache::lookup(
+	const MathTypes::Vector<3, float>& point,
+	const MathTypes::Vector<3, float>& surfaceNormal,
+	int light) const
+{
+	auto entry = entries_.find(cellContaining(point, surfaceNormal, light));
+	if(entry != entries_.end())
+	{
+		return entry->second;
+	}
+	else
+	{
+		return std::nullopt;
+	}
+}
+
+void RayTracing::IrradianceCache::insert(
+	const MathTypes::Vector<3, float>& point,
+	const MathTypes::Vector<3, float>& surfaceNormal,
+	int light,
+	const Entry& entry)
+{
+	entries_.insert({cellContaining(point, surfaceNormal, light), entry});
+}
+
+void RayTracing::IrradianceCache::prepareForLights(const std::vector<PointLight>& lights)
+{
+	bool lightsAreUnchanged = lightPositions_ && lightPositions_->size() == lights.size();
+	for(std::size_t i = 0; lightsAreUnchanged && i < lights.size(); i++)
+	{
+		lightsAreUnchanged = pointsAreEqual((*lightPositions_)[i], lights[i].position);
+	}
+
+	if(!lightsAreUnchanged)
+	{
+		clear();
+		lightPositions_.emplace();
+		for(const auto& light : lights)
+		{
+			lightPositions_->push_back(light.position);
+		}
+	}
+}
+
+void RayTracing::IrradianceCache::clear()
+{
+	entries_.clear();
+	lightPositions_ = std::nullopt;
+}
+
+std::size_t RayTracing::IrradianceCache::CellHash::operator()(const Cell& cell) const
+{
+	//Spatial hash from Teschner et al., "Optimized Spatial Hashing for Collision Detection of Deformable Objects"
+	std::uint64_t hash = (static_cast<std::uint64_t>(cell.x) * 73856093u)
+		^ (static_cast<std::uint64_t>(cell.y) * 19349663u)
+		^ (static_cast<std::uint64_t>(cell.z) * 83492791u);
+	hash = (hash * 6 + cell.normalDirection) ^ (static_cast<std::uint64_t>(cell.light) * 2654435761u);
+	return static_cast<std::size_t>(hash);
+}
+
+RayTracing::IrradianceCache::Cell RayTracing::IrradianceCache::cellContaining(
+	const MathTypes::Vector<3, float>& point,
+	const MathTypes::Vector<3, float>& surfaceNormal,
+	int light) const
+{
+	const float x = surfaceNormal.xValue();
+	const float y = surfaceNormal.yValue();
+	const float z = surfaceNormal.zValue();
+
+	int normalDirection;
+	if(std::abs(x) >= std::abs(y) && std::abs(x) >= std::abs(z))
+	{
+		normalDirection = x >= 0 ? 0 : 1;
+	}
+	else if(std::abs(y) >= std::abs(z))
+	{
+		normalDirection = y >= 0 ? 2 : 3;
+	}
+	else
+	{
+		normalDirection = z >= 0 ? 4 : 5;
+	}
+
+	return Cell{
+		static_cast<int>(std::floor(point.xValue() / cellSize_)),
+		static_cast<int>(std::floor(point.yValue() / cellSize_)),
+		static_cast<int>(std::floor(point.zValue() / cellSize_)),
+		normalDirection,
+		light};
+}
\ No newline at end of file
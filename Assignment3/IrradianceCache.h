@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "assignmentSpecific/PointLight.h"
+#include "math/Vector.h"
+
+namespace RayTracing
+{
+	//World space hash grid of the view independent part of direct lighting: the diffuse term and whether the
+	//light is visible. Surface points that fall in the same cell and face the same way share an entry for each
+	//light, so for static scenes lit by static lights the shadow ray of a cell is only traced once per light, no
+	//matter how many frames or pixels land in it. Entries become stale whenever the scene or a light moves, so the
+	//owner must clear the cache when that happens.
+	class IrradianceCache
+	{
+	public:
+		struct Entry
+		{
+			float diffuseComponent;
+			bool pointIsLit;
+		};
+
+		explicit IrradianceCache(float cellSize);
+		~IrradianceCache() = default;
+
+		//Lights are identified by their index in the list given to prepareForLights()
+		std::optional<Entry> lookup(
+			const MathTypes::Vector<3, float>& point,
+			const MathTypes::Vector<3, float>& surfaceNormal,
+			int light) const;
+		void insert(
+			const MathTypes::Vector<3, float>& point,
+			const MathTypes::Vector<3, float>& surfaceNormal,
+			int light,
+			const Entry& entry);
+
+		//Clears the cache if any light has moved, or lights were added or removed, since the cached entries were
+		//calculated
+		void prepareForLights(const std::vector<PointLight>& lights);
+		void clear();
+
+	private:
+		struct Cell
+		{
+			int x;
+			int y;
+			int z;
+			//Which of the six axis directions the surface normal is closest to. Keeps both sides of thin
+			//objects, and the faces meeting at a corner, from sharing an entry.
+			int normalDirection;
+			int light;
+
+			bool operator==(const Cell& other) const
+			{
+				return x == other.x && y == other.y && z == other.z && normalDirection == other.normalDirection
+					&& light == other.light;
+			}
+		};
+
+		struct CellHash
+		{
+			std::size_t operator()(const Cell& cell) const;
+		};
+
+		Cell cellContaining(
+			const MathTypes::Vector<3, float>& point,
+			const MathTypes::Vector<3, float>& surfaceNormal,
+			int light) const;
+
+	private:
+		float cellSize_;
+		std::optional<std::vector<MathTypes::Vector<3, float>>> lightPositions_;
+		std::unordered_map<Cell, Entry, CellHash> entries_;
+	};
+}
\ No newline at end of file
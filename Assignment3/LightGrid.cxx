@@ -0,0 +1,170 @@
+#include "assignmentSpecific/LightGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "math/LinearMath.h"
+#include "math/Vector.h"
+
+namespace
+{
+	//Caps the memory of the grid when a few lights are spread far apart
+	const int MAXIMUM_NUMBER_OF_CELLS = 64 * 64 * 64;
+
+	float componentAlongAxis(const MathTypes::Vector<3, float>& vector, int axis)
+	{
+		switch(axis)
+		{
+			case(0):
+				return vector.xValue();
+			case(1):
+				return vector.yValue();
+			default:
+				return vector.zValue();
+		}
+	}
+}
+
+RayTracing::LightGrid::LightGrid()
+	: bounds_(BoundingBox::emptyBox())
+	, cellSize_(1)
+	, numberOfCells_{1, 1, 1}
+	, firstReferenceOfCell_(2, 0)
+{
+}
+
+RayTracing::LightGrid::LightGrid(const std::vector<PointLight>& lights)
+	: LightGrid()
+{
+	lights_ = lights;
+
+	std::vector<int> boundedLights;
+	float totalRadius = 0;
+	for(int i = 0; i < static_cast<int>(lights_.size()); i++)
+	{
+		const auto& light = lights_[i];
+		if(std::isinf(light.radius))
+		{
+			unboundedLights_.push_back(i);
+			continue;
+		}
+		boundedLights.push_back(i);
+		totalRadius += light.radius;
+		bounds_ = bounds_.enclosing(BoundingBox(
+			light.position - MathTypes::Vector<3, float>(light.radius, light.radius, light.radius),
+			light.position + MathTypes::Vector<3, float>(light.radius, light.radius, light.radius)));
+	}
+	if(boundedLights.empty())
+	{
+		return;
+	}
+
+	//Cells as wide as the average radius list a light in at most 27 cells. They are made larger if that would
+	//take too many cells.
+	auto extent = bounds_.maximumCorner() - bounds_.minimumCorner();
+	cellSize_ = totalRadius / boundedLights.size();
+	const float cellsAtAverageRadius = std::ceil(extent.xValue() / cellSize_) * std::ceil(extent.yValue() / cellSize_)
+		* std::ceil(extent.zValue() / cellSize_);
+	if(cellsAtAverageRadius > MAXIMUM_NUMBER_OF_CELLS)
+	{
+		cellSize_ *= std::cbrt(cellsAtAverageRadius / MAXIMUM_NUMBER_OF_CELLS) * 1.01f;
+	}
+	if(!(cellSize_ > 0))
+	{
+		cellSize_ = 1;
+	}
+	for(int axis = 0; axis < 3; axis++)
+	{
+		numberOfCells_[axis] = std::max(1, static_cast<int>(std::ceil(componentAlongAxis(extent, axis) / cellSize_)));
+	}
+	const int totalNumberOfCells = numberOfCells_[0] * numberOfCells_[1] * numberOfCells_[2];
+
+	//List each light in every cell that its bounds overlap. Counted first so the lists can be packed together.
+	auto forEachCellOverlappedByLight = [&](int lightIndex, auto action)
+	{
+		const auto& light = lights_[lightIndex];
+		int lowestCell[3];
+		int highestCell[3];
+		for(int axis = 0; axis < 3; axis++)
+		{
+			lowestCell[axis] = cellAlongAxis(componentAlongAxis(light.position, axis) - light.radius, axis);
+			highestCell[axis] = cellAlongAxis(componentAlongAxis(light.position, axis) + light.radius, axis);
+		}
+		for(int cellZ = lowestCell[2]; cellZ <= highestCell[2]; cellZ++)
+		{
+			for(int cellY = lowestCell[1]; cellY <= highestCell[1]; cellY++)
+			{
+				for(int cellX = lowestCell[0]; cellX <= highestCell[0]; cellX++)
+				{
+					action(indexOfCell(cellX, cellY, cellZ));
+				}
+			}
+		}
+	};
+
+	firstReferenceOfCell_.assign(totalNumberOfCells + 1, 0);
+	for(int i : boundedLights)
+	{
+		forEachCellOverlappedByLight(i, [&](int cellIndex)
+			{
+				firstReferenceOfCell_[cellIndex + 1]++;
+			});
+	}
+	std::partial_sum(std::begin(firstReferenceOfCell_), std::end(firstReferenceOfCell_), std::begin(firstReferenceOfCell_));
+
+	lightReferences_.resize(firstReferenceOfCell_.back());
+	std::vector<int> nextReferenceOfCell(std::begin(firstReferenceOfCell_), std::end(firstReferenceOfCell_) - 1);
+	for(int i : boundedLights)
+	{
+		forEachCellOverlappedByLight(i, [&](int cellIndex)
+			{
+				lightReferences_[nextReferenceOfCell[cellIndex]++] = i;
+			});
+	}
+}
+
+void RayTracing::LightGrid::lightsReachingPoint(
+	const MathTypes::Vector<3, float>& point,
+	std::vector<int>* lightIndices) const
+{
+	lightIndices->clear();
+	const int numberOfUnboundedLights = unboundedLights_.size();
+	if(lightReferences_.empty())
+	{
+		lightIndices->assign(std::begin(unboundedLights_), std::end(unboundedLights_));
+		return;
+	}
+
+	const int cellIndex = indexOfCell(
+		cellAlongAxis(point.xValue(), 0), cellAlongAxis(point.yValue(), 1), cellAlongAxis(point.zValue(), 2));
+	int nextUnboundedLight = 0;
+	for(int i = firstReferenceOfCell_[cellIndex]; i < firstReferenceOfCell_[cellIndex + 1]; i++)
+	{
+		const int lightIndex = lightReferences_[i];
+		const auto& light = lights_[lightIndex];
+		if(LinearMath::distanceBetweenPoints(point, light.position) >= light.radius)
+		{
+			continue;
+		}
+		//Both lists are in increasing order, so merging them keeps the result in order
+		while(nextUnboundedLight < numberOfUnboundedLights && unboundedLights_[nextUnboundedLight] < lightIndex)
+		{
+			lightIndices->push_back(unboundedLights_[nextUnboundedLight++]);
+		}
+		lightIndices->push_back(lightIndex);
+	}
+	lightIndices->insert(std::end(*lightIndices), std::begin(unboundedLights_) + nextUnboundedLight, std::end(unboundedLights_));
+}
+
+int RayTracing::LightGrid::cellAlongAxis(float coordinate, int axis) const
+{
+	const float distanceIntoGrid = coordinate - componentAlongAxis(bounds_.minimumCorner(), axis);
+	const int cell = static_cast<int>(std::floor(distanceIntoGrid / cellSize_));
+	return std::clamp(cell, 0, numberOfCells_[axis] - 1);
+}
+
+int RayTracing::LightGrid::indexOfCell(int x, int y, int z) const
+{
+	return (z * numberOfCells_[1] + y) * numberOfCells_[0] + x;
+}
\ No newline at end of file
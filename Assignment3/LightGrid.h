@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+
+#include "assignmentSpecific/BoundingBox.h"
+#include "assignmentSpecific/PointLight.h"
+
+namespace MathTypes
+{
+	template<int dimensions, typename CoordinatePrimitive> class Vector;
+}
+
+namespace RayTracing
+{
+	//Uniform grid over the spheres that a set of lights can reach. Each cell lists the lights whose sphere overlaps
+	//it, so finding the lights that reach a point takes one cell lookup and a distance test for each light listed
+	//there, instead of a test against every light. Lights with an infinite radius reach every point and are kept
+	//out of the grid.
+	class LightGrid
+	{
+	public:
+		LightGrid();
+		explicit LightGrid(const std::vector<PointLight>& lights);
+		~LightGrid() = default;
+
+		//Writes the indices of the lights whose radius contains the point, in increasing order
+		void lightsReachingPoint(const MathTypes::Vector<3, float>& point, std::vector<int>* lightIndices) const;
+
+	private:
+		int cellAlongAxis(float coordinate, int axis) const;
+		int indexOfCell(int x, int y, int z) const;
+
+	private:
+		std::vector<PointLight> lights_;
+		std::vector<int> unboundedLights_;
+		BoundingBox bounds_;
+		float cellSize_;
+		int numberOfCells_[3];
+		//The lights overlapping cell i are lightReferences_[firstReferenceOfCell_[i]] up to, but not including,
+		//lightReferences_[firstReferenceOfCell_[i + 1]]
+		std::vector<int> firstReferenceOfCell_;
+		std::vector<int> lightReferences_;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,265 @@
+#include "assignmentSpecific/MengerSpongeTraversal.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "math/Matrix.h"
+#include "math/Vector.h"
+
+namespace
+{
+	//Keeps rays leaving the surface of the sponge from hitting that same surface again
+	const float MINIMUM_INTERSECTION_DISTANCE = 1e-4;
+
+	//Points further than this from a face of the smallest cubes, in sizes of those cubes, are not on the surface
+	const float SURFACE_TOLERANCE = 1e-2;
+
+	int indexOfSubCube(float positionInCube)
+	{
+		return std::clamp(static_cast<int>(std::floor(positionInCube * 3)), 0, 2);
+	}
+}
+
+RayTracing::MengerSpongeTraversal::MengerSpongeTraversal(const Shapes::MengerSponge<float>& sponge)
+	: sponge_(sponge)
+{
+}
+
+const Shapes::MengerSponge<float>& RayTracing::MengerSpongeTraversal::sponge() const
+{
+	return sponge_;
+}
+
+RayTracing::BoundingBox RayTracing::MengerSpongeTraversal::boundingBox() const
+{
+	const auto corner = sponge_.frontBottomLeft();
+	const float side = sponge_.sideLength();
+	return BoundingBox(
+		corner - MathTypes::Vector<3, float>(0, 0, side),
+		corner + MathTypes::Vector<3, float>(side, side, 0));
+}
+
+void RayTracing::MengerSpongeTraversal::transform(const MathTypes::Matrix<4, 4, float>& transformationMatrix)
+{
+	sponge_.transform(transformationMatrix);
+}
+
+std::optional<float> RayTracing::MengerSpongeTraversal::closestIntersection(const Ray& ray) const
+{
+	LocalRay localRay;
+	toLocalCoordinates(ray.origin(), localRay.origin);
+	const auto direction = ray.direction();
+	const float inverseSide = 1 / sponge_.sideLength();
+	localRay.direction[0] = direction.xValue() * inverseSide;
+	localRay.direction[1] = direction.yValue() * inverseSide;
+	localRay.direction[2] = -direction.zValue() * inverseSide;
+
+	//Scaling the direction along with the sponge keeps distances along the ray the same in both coordinates
+	float entryDistance = MINIMUM_INTERSECTION_DISTANCE;
+	float exitDistance = std::numeric_limits<float>::infinity();
+	for(int axis = 0; axis < 3; axis++)
+	{
+		localRay.inverseDirection[axis] = 1 / localRay.direction[axis];
+		float distanceToMinimum = -localRay.origin[axis] * localRay.inverseDirection[axis];
+		float distanceToMaximum = (1 - localRay.origin[axis]) * localRay.inverseDirection[axis];
+		if(distanceToMinimum > distanceToMaximum)
+		{
+			std::swap(distanceToMinimum, distanceToMaximum);
+		}
+		entryDistance = std::max(entryDistance, distanceToMinimum);
+		exitDistance = std::min(exitDistance, distanceToMaximum);
+	}
+	if(!(entryDistance <= exitDistance))
+	{
+		return std::nullopt;
+	}
+
+	const float corner[3] = {0, 0, 0};
+	return firstSolidDistanceInCube(localRay, sponge_.levelOfRecursion(), corner, 1, entryDistance, exitDistance);
+}
+
+std::optional<MathTypes::Vector<3, float>> RayTracing::MengerSpongeTraversal::surfaceNormalAtPoint(
+	const MathTypes::Vector<3, float>& point) const
+{
+	float localPoint[3];
+	toLocalCoordinates(point, localPoint);
+	const float cubesAlongSide = std::pow(3.0f, sponge_.levelOfRecursion());
+
+	//The point lies on a face of the smallest cubes, so along one axis it sits on the boundary between a
+	//solid cube and an empty one. Check the axes in order of how close the point is to such a boundary.
+	int axes[3] = {0, 1, 2};
+	float distanceToBoundary[3];
+	for(int axis = 0; axis < 3; axis++)
+	{
+		const float position = localPoint[axis] * cubesAlongSide;
+		distanceToBoundary[axis] = std::abs(position - std::round(position));
+	}
+	std::sort(std::begin(axes), std::end(axes), [&](int a, int b)
+		{
+			return distanceToBoundary[a] < distanceToBoundary[b];
+		});
+
+	for(int axis : axes)
+	{
+		if(distanceToBoundary[axis] > SURFACE_TOLERANCE)
+		{
+			break;
+		}
+
+		//On an edge the point also lies on a boundary along another axis, and which side of it the probes fall
+		//on decides what they see. Try both sides of every such boundary.
+		const int otherAxes[2] = {(axis + 1) % 3, (axis + 2) % 3};
+		for(int nudges = 0; nudges < 4; nudges++)
+		{
+			float before[3] = {localPoint[0], localPoint[1], localPoint[2]};
+			for(int i = 0; i < 2; i++)
+			{
+				if(distanceToBoundary[otherAxes[i]] <= SURFACE_TOLERANCE)
+				{
+					before[otherAxes[i]] += ((nudges >> i) & 1 ? 0.25f : -0.25f) / cubesAlongSide;
+				}
+			}
+			float after[3] = {before[0], before[1], before[2]};
+			before[axis] -= 0.5f / cubesAlongSide;
+			after[axis] += 0.5f / cubesAlongSide;
+			const bool solidBefore = localPointIsSolid(before);
+			if(solidBefore == localPointIsSolid(after))
+			{
+				continue;
+			}
+
+			//Points out of the solid side, flipping the third axis back to world coordinates
+			float normal[3] = {0, 0, 0};
+			normal[axis] = solidBefore ? 1 : -1;
+			return MathTypes::Vector<3, float>(normal[0], normal[1], -normal[2]);
+		}
+	}
+	return std::nullopt;
+}
+
+void RayTracing::MengerSpongeTraversal::toLocalCoordinates(const MathTypes::Vector<3, float>& point, float* localPoint) const
+{
+	const auto corner = sponge_.frontBottomLeft();
+	const float inverseSide = 1 / sponge_.sideLength();
+	localPoint[0] = (point.xValue() - corner.xValue()) * inverseSide;
+	localPoint[1] = (point.yValue() - corner.yValue()) * inverseSide;
+	localPoint[2] = (corner.zValue() - point.zValue()) * inverseSide;
+}
+
+std::optional<float> RayTracing::MengerSpongeTraversal::firstSolidDistanceInCube(
+	const LocalRay& ray,
+	int levelsBelow,
+	const float* corner,
+	float size,
+	float entryDistance,
+	float exitDistance) const
+{
+	if(levelsBelow == 0)
+	{
+		return entryDistance;
+	}
+
+	//Set up the walk through the sub-cubes from where the ray enters this cube
+	const float subCubeSize = size / 3;
+	int subCube[3];
+	int step[3];
+	float distanceToNextCrossing[3];
+	float distanceBetweenCrossings[3];
+	for(int axis = 0; axis < 3; axis++)
+	{
+		const float entryPosition = ray.origin[axis] + entryDistance * ray.direction[axis];
+		subCube[axis] = indexOfSubCube((entryPosition - corner[axis]) / size);
+		if(ray.direction[axis] > 0)
+		{
+			step[axis] = 1;
+			distanceToNextCrossing[axis] =
+				(corner[axis] + (subCube[axis] + 1) * subCubeSize - ray.origin[axis]) * ray.inverseDirection[axis];
+			distanceBetweenCrossings[axis] = subCubeSize * ray.inverseDirection[axis];
+		}
+		else if(ray.direction[axis] < 0)
+		{
+			step[axis] = -1;
+			distanceToNextCrossing[axis] =
+				(corner[axis] + subCube[axis] * subCubeSize - ray.origin[axis]) * ray.inverseDirection[axis];
+			distanceBetweenCrossings[axis] = -subCubeSize * ray.inverseDirection[axis];
+		}
+		else
+		{
+			step[axis] = 0;
+			distanceToNextCrossing[axis] = std::numeric_limits<float>::infinity();
+			distanceBetweenCrossings[axis] = std::numeric_limits<float>::infinity();
+		}
+	}
+
+	float distanceEnteringSubCube = entryDistance;
+	while(true)
+	{
+		int axisOfNextCrossing = 0;
+		if(distanceToNextCrossing[1] < distanceToNextCrossing[axisOfNextCrossing])
+		{
+			axisOfNextCrossing = 1;
+		}
+		if(distanceToNextCrossing[2] < distanceToNextCrossing[axisOfNextCrossing])
+		{
+			axisOfNextCrossing = 2;
+		}
+		const float distanceLeavingSubCube = std::min(distanceToNextCrossing[axisOfNextCrossing], exitDistance);
+
+		if(Shapes::MengerSponge<float>::subCubeIsSolid(subCube[0], subCube[1], subCube[2])
+			&& distanceEnteringSubCube <= distanceLeavingSubCube)
+		{
+			const float subCubeCorner[3] = {
+				corner[0] + subCube[0] * subCubeSize,
+				corner[1] + subCube[1] * subCubeSize,
+				corner[2] + subCube[2] * subCubeSize};
+			auto hit = firstSolidDistanceInCube(
+				ray, levelsBelow - 1, subCubeCorner, subCubeSize, distanceEnteringSubCube, distanceLeavingSubCube);
+			if(hit)
+			{
+				return hit;
+			}
+		}
+
+		if(distanceToNextCrossing[axisOfNextCrossing] >= exitDistance)
+		{
+			return std::nullopt;
+		}
+		subCube[axisOfNextCrossing] += step[axisOfNextCrossing];
+		if(subCube[axisOfNextCrossing] < 0 || subCube[axisOfNextCrossing] > 2)
+		{
+			return std::nullopt;
+		}
+		distanceEnteringSubCube = distanceToNextCrossing[axisOfNextCrossing];
+		distanceToNextCrossing[axisOfNextCrossing] += distanceBetweenCrossings[axisOfNextCrossing];
+	}
+}
+
+bool RayTracing::MengerSpongeTraversal::localPointIsSolid(const float* localPoint) const
+{
+	float position[3];
+	for(int axis = 0; axis < 3; axis++)
+	{
+		if(localPoint[axis] < 0 || localPoint[axis] > 1)
+		{
+			return false;
+		}
+		position[axis] = localPoint[axis];
+	}
+
+	//Zoom into the sub-cube containing the point, one level at a time
+	for(int level = 0; level < sponge_.levelOfRecursion(); level++)
+	{
+		int subCube[3];
+		for(int axis = 0; axis < 3; axis++)
+		{
+			subCube[axis] = indexOfSubCube(position[axis]);
+			position[axis] = position[axis] * 3 - subCube[axis];
+		}
+		if(!Shapes::MengerSponge<float>::subCubeIsSolid(subCube[0], subCube[1], subCube[2]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <optional>
+
+#include "assignmentSpecific/BoundingBox.h"
+#include "assignmentSpecific/Ray.h"
+#include "shapes/MengerSponge.h"
+
+namespace MathTypes
+{
+	template<int rows, int columns, typename CoordinatePrimitive> class Matrix;
+	template<int dimensions, typename CoordinatePrimitive> class Vector;
+}
+
+namespace RayTracing
+{
+	//Intersects rays with a Menger sponge without building any of its cubes. Rays walk the 3x3x3 sub-cubes of the
+	//sponge in the order they pass through them (3D-DDA, Amanatides and Woo), and descend into each solid one
+	//they meet, level by level, until they reach a sub-cube of the last level, which is the hit. Memory stays
+	//constant, and a ray passes through at most seven sub-cubes per level it descends, so the cost grows with the
+	//level of recursion rather than with the 20^level cubes it describes.
+	class MengerSpongeTraversal
+	{
+	public:
+		MengerSpongeTraversal(const Shapes::MengerSponge<float>& sponge);
+		~MengerSpongeTraversal() = default;
+
+		const Shapes::MengerSponge<float>& sponge() const;
+		BoundingBox boundingBox() const;
+		void transform(const MathTypes::Matrix<4, 4, float>& transformationMatrix);
+
+		//Distance along the ray to the closest point where it enters a solid part of the sponge
+		std::optional<float> closestIntersection(const Ray& ray) const;
+		//The normal of the face of the smallest cubes that the point lies on. Empty if the point is not on the
+		//surface of the sponge.
+		std::optional<MathTypes::Vector<3, float>> surfaceNormalAtPoint(const MathTypes::Vector<3, float>& point) const;
+
+	private:
+		//The sponge is traversed in its own coordinates, in which it is the unit cube, with the third axis
+		//pointing along -z so that all three indices of sub-cubes grow along their axes
+		struct LocalRay
+		{
+			float origin[3];
+			float direction[3];
+			float inverseDirection[3];
+		};
+
+		void toLocalCoordinates(const MathTypes::Vector<3, float>& point, float* localPoint) const;
+		//Distance to the first solid point of the sub-cube at corner, which the ray crosses between entryDistance
+		//and exitDistance
+		std::optional<float> firstSolidDistanceInCube(
+			const LocalRay& ray,
+			int levelsBelow,
+			const float* corner,
+			float size,
+			float entryDistance,
+			float exitDistance) const;
+		bool localPointIsSolid(const float* localPoint) const;
+
+	private:
+		Shapes::MengerSponge<float> sponge_;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+#include "math/Vector.h"
+
+namespace RayTracing
+{
+	//A light that shines equally in every direction. Its light fades out smoothly with distance and stops at its
+	//radius, which is what lets points outside the radius skip the light, and its shadow ray, entirely. A light
+	//with an infinite radius does not fade and reaches everything, like the single light the ray tracer started with.
+	struct PointLight
+	{
+		PointLight(
+			const MathTypes::Vector<3, float>& position,
+			float intensity = 1,
+			float radius = std::numeric_limits<float>::infinity());
+
+		//Fraction of the intensity that arrives at the given distance: (1 - (d/r)^2)^2 inside the radius, which
+		//falls to zero with zero slope at the radius, and nothing beyond it
+		float falloffAtDistance(float distance) const;
+
+		MathTypes::Vector<3, float> position;
+		float intensity;
+		float radius;
+	};
+}
+
+inline RayTracing::PointLight::PointLight(const MathTypes::Vector<3, float>& position, float intensity, float radius)
+	: position(position)
+	, intensity(intensity)
+	, radius(radius)
+{
+}
+
+inline float RayTracing::PointLight::falloffAtDistance(float distance) const
+{
+	if(std::isinf(radius))
+	{
+		return 1;
+	}
+	if(distance >= radius)
+	{
+		return 0;
+	}
+	const float fractionOfRadius = distance / radius;
+	const float falloff = 1 - fractionOfRadius * fractionOfRadius;
+	return falloff * falloff;
+}
\ No newline at end of file
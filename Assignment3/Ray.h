@@ -1,8 +1,8 @@
-#pragma once
-
-#include "math/Line.h"
-
-namespace RayTracing
-{
-	using Ray = MathTypes::Line<3, float>;
+#pragma once
+
+#include "math/Line.h"
+
+namespace RayTracing
+{
+	using Ray = MathTypes::Line<3, float>;
 }
\ No newline at end of file
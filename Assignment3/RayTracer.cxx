@@ -1,177 +1,596 @@
-#include "assignmentSpecific/RayTracer.h"
-
-#include <limits>
-
-#include "assignmentSpecific/TutorialLibraries/grid2.h"
-#include "assignmentSpecific/TutorialLibraries/ImagePlane.h"
-#include "assignmentSpecific/TutorialLibraries/image.h"
-
-#include "assignmentSpecific/I_IntersectableShape.h"
-#include "glUtility/Vertex.h"
-#include "math/LinearMath.h"
-#include "math/Vector.h"
-
-namespace
-{
-	const GLUtility::Colour<float> BACKGROUND_COLOUR(0.05, 0.05, 0.1);
-}
-
-RayTracing::RayTracer::RayTracer(const std::list<std::shared_ptr<I_IntersectableShape>>& objectsOfScene)
-	: objectsOfScene_(objectsOfScene)
-{
-}
-
-geometry::Grid2<raster::RGB> RayTracing::RayTracer::renderSceneGivenParameters(
-	const MathTypes::Vector<3, float>& eyePosition,
-	const MathTypes::Vector<3, float>& lightPosition,
-	RayTracing::ImagePlane& imagePlane)
-{
-	for(int x = 0; x < imagePlane.screen.width(); x++)
-	{
-		for(int y = 0; y < imagePlane.screen.height(); y++)
-		{
-			auto pointOnImagePlane = imagePlane.pixelTo3D(x, y);
-			auto rayDirection = (pointOnImagePlane - eyePosition).normalized();
-			RayTracing::Ray rayFromImagePlane(pointOnImagePlane, rayDirection);
-
-			I_IntersectableShape* closestIntersectedShape = NULL;
-			auto closestIntersectionPointOfAllObjects = determineClosestIntersectionPoint(
-				&closestIntersectedShape, rayFromImagePlane);
-
-			auto outputColour = BACKGROUND_COLOUR;
-			if(closestIntersectedShape != NULL)
-			{
-				auto intersectionToLight = (lightPosition - *closestIntersectionPointOfAllObjects).normalized();
-				auto surfaceNormal = *(closestIntersectedShape->surfaceNormalAtPoint(*closestIntersectionPointOfAllObjects));
-				auto intersectionToEye = (eyePosition - *closestIntersectionPointOfAllObjects).normalized();
-
-				float totalLight = determineTotalLightAtPoint(
-					*closestIntersectionPointOfAllObjects, surfaceNormal, intersectionToLight, intersectionToEye);
-				outputColour = determineColourAtPoint(
-					totalLight, *closestIntersectionPointOfAllObjects, surfaceNormal, intersectionToEye, closestIntersectedShape);
-			}
-			imagePlane.screen({x, y}) = raster::convertToRGB(outputColour);
-		}
-	}
-	return imagePlane.screen;
-}
-
-std::optional<MathTypes::Vector<3, float>> RayTracing::RayTracer::determineClosestIntersectionPoint(
-	I_IntersectableShape** closestIntersectedShape,
-	const Ray& ray) const
-{
-	I_IntersectableShape* temporaryClosestIntersectedShape = NULL;
-	MathTypes::Vector<3, float> closestIntersectionPointOfAllObjects(
-		std::numeric_limits<float>::infinity(),
-		std::numeric_limits<float>::infinity(), 
-		std::numeric_limits<float>::infinity());
-	for(const auto object : objectsOfScene_)
-	{
-		auto closestIntersectionPointOfObject = object->closestIntersectionPoint(ray);
-		if(closestIntersectionPointOfObject && 
-			LinearMath::distanceBetweenPointsSquared(ray.origin(), *closestIntersectionPointOfObject) 
-			< LinearMath::distanceBetweenPointsSquared(ray.origin(), closestIntersectionPointOfAllObjects))
-		{
-			temporaryClosestIntersectedShape = object.get();
-			closestIntersectionPointOfAllObjects = *closestIntersectionPointOfObject;
-		}
-	}
-
-	if(temporaryClosestIntersectedShape != NULL)
-	{
-		*closestIntersectedShape = temporaryClosestIntersectedShape;
-		return closestIntersectionPointOfAllObjects;
-	}
-	else
-	{
-		return std::nullopt;
-	}
-}
-
-bool RayTracing::RayTracer::rayIntersectsAnObject(const Ray& ray) const
-{
-	for(const auto object : objectsOfScene_)
-	{
-		auto intersectionPoints = object->intersectionPoints(ray);
-		if(intersectionPoints)
-		{
-			return true;
-		}
-	}
-	return false;
-}
-
-float RayTracing::RayTracer::determineTotalLightAtPoint(
-	const MathTypes::Vector<3, float>& point,
-	const MathTypes::Vector<3, float>& surfaceNormal,
-	const MathTypes::Vector<3, float>& pointToLight,
-	const MathTypes::Vector<3, float>& pointToEye) const
-{
-	auto reflectedLight = 2 * LinearMath::dotProduct(pointToLight, surfaceNormal) 
-									* (surfaceNormal - pointToLight);
-	
-	float ambientComponent = 0.4;
-	float diffuseComponent = 0.4 * LinearMath::dotProduct(pointToLight, surfaceNormal);
-	float specularComponent = LinearMath::dotProduct(reflectedLight, pointToEye);
-	specularComponent = 0.2 * specularComponent * specularComponent;
-
-	RayTracing::Ray rayToLight(point + 0.1*pointToLight, pointToLight);
-	if(rayIntersectsAnObject(rayToLight))
-	{
-		diffuseComponent = 0;
-		specularComponent = 0;
-	}
-	return ambientComponent + diffuseComponent + specularComponent;
-}
-
-GLUtility::Colour<float> RayTracing::RayTracer::determineColourAtPoint(
-	float lightAtPoint,
-	const MathTypes::Vector<3, float>& point,
-	const MathTypes::Vector<3, float>& surfaceNormal,
-	const MathTypes::Vector<3, float>& pointToEye,
-	const I_IntersectableShape* shapeThatPointLiesOn) const
-{
-	auto reflectionFromEye = 2 * LinearMath::dotProduct(pointToEye, surfaceNormal) 
-										* (surfaceNormal - pointToEye);
-
-	auto colourAtPoint = shapeThatPointLiesOn->colourOfShape();
-	colourAtPoint.red = colourAtPoint.red * lightAtPoint;
-	colourAtPoint.green = colourAtPoint.green * lightAtPoint;
-	colourAtPoint.blue = colourAtPoint.blue * lightAtPoint;
-
-	if(shapeThatPointLiesOn->surfaceIsReflective())
-	{
-		RayTracing::Ray reflectionRay(point + 0.1*reflectionFromEye, reflectionFromEye);
-		colourAtPoint = reflectedColourFromRay(colourAtPoint, reflectionRay, 0);
-	}
-	return colourAtPoint;
-}
-
-GLUtility::Colour<float> RayTracing::RayTracer::reflectedColourFromRay(
-	const GLUtility::Colour<float> initialColour,
-	const Ray& reflectionRay,
-	int levelOfReflectionRecursion) const
-{
-	I_IntersectableShape* closestReflectingShape = NULL;
-	auto closestReflectionPointOfAllObjects = determineClosestIntersectionPoint(&closestReflectingShape, reflectionRay);
-
-	auto outputColour = initialColour;
-	if(closestReflectingShape != NULL && levelOfReflectionRecursion < 10)
-	{
-		outputColour = outputColour * closestReflectingShape->colourOfShape();
-
-		if(closestReflectingShape->surfaceIsReflective())
-		{
-			auto surfaceNormal = *(closestReflectingShape->surfaceNormalAtPoint(*closestReflectionPointOfAllObjects));
-			auto reflectionVector = (*closestReflectionPointOfAllObjects - reflectionRay.origin()).normalized();
-			auto reflectedReflectionVector = 2 * LinearMath::dotProduct(reflectionVector, surfaceNormal) 
-														  * (surfaceNormal - reflectionVector);
-
-			outputColour = reflectedColourFromRay(
-				outputColour, 
-				RayTracing::Ray(*closestReflectionPointOfAllObjects + 0.1*reflectedReflectionVector, reflectedReflectionVector),
-				levelOfReflectionRecursion+1);
-		}
-	}
-	return outputColour;
+#include "assignmentSpecific/RayTracer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+
+#include "assignmentSpecific/TutorialLibraries/grid2.h"
+#include "assignmentSpecific/TutorialLibraries/ImagePlane.h"
+#include "assignmentSpecific/TutorialLibraries/image.h"
+
+#include "assignmentSpecific/BatchShading.h"
+#include "assignmentSpecific/Frustum.h"
+#include "assignmentSpecific/I_IntersectableShape.h"
+#include "glUtility/Vertex.h"
+#include "math/LinearMath.h"
+#include "math/Matrix.h"
+#include "math/Vector.h"
+#include "profiling/Profiler.h"
+
+namespace
+{
+	const GLUtility::Colour<float> BACKGROUND_COLOUR(0.05, 0.05, 0.1);
+
+	//Regions are traced in square tiles of this many pixels a side, each with its own list of the objects that
+	//its primary rays can hit
+	const int TILE_SIZE = 16;
+	//Tiles that see more objects than this leave their primary rays to the scene geometry, whose own structure
+	//culls a large number of objects better than testing each of them
+	const int MAXIMUM_CANDIDATES_TESTED_DIRECTLY = 16;
+	//Keeps rays that graze flat objects like quadrilaterals from being culled by floating point error
+	const float BOUNDS_PADDING = 1e-3;
+
+	//How far apart, relative to their depth, two neighbouring samples of an object can be while still being
+	//considered part of the same continuous surface
+	const float RELATIVE_DEPTH_TOLERANCE = 0.05;
+
+	bool samplesLieOnSameSurface(
+		const RayTracing::GeometryBuffer::Sample& a,
+		const RayTracing::GeometryBuffer::Sample& b)
+	{
+		if(a.object != b.object)
+		{
+			return false;
+		}
+		return a.object == NULL
+			|| std::abs(a.depth - b.depth) <= RELATIVE_DEPTH_TOLERANCE * std::min(a.depth, b.depth);
+	}
+
+	RayTracing::GeometryBuffer::Sample averageOfSamples(
+		const RayTracing::GeometryBuffer::Sample& a,
+		const RayTracing::GeometryBuffer::Sample& b)
+	{
+		RayTracing::GeometryBuffer::Sample average;
+		average.colour = GLUtility::Colour<float>(
+			0.5 * (a.colour.red + b.colour.red),
+			0.5 * (a.colour.green + b.colour.green),
+			0.5 * (a.colour.blue + b.colour.blue));
+		average.object = a.object;
+		average.normal = a.normal;
+		average.depth = a.object != NULL ? 0.5 * (a.depth + b.depth) : a.depth;
+		return average;
+	}
+
+	//Pseudo random number in [0, 1) that depends only on its arguments, from a 32 bit integer hash
+	//(Chris Wellons' "lowbias32"). Cheap enough to call for every light sample, unlike seeding a generator.
+	float randomFraction(int x, int y, int sample)
+	{
+		std::uint32_t hash = static_cast<std::uint32_t>(x) * 73856093u
+			^ static_cast<std::uint32_t>(y) * 19349663u
+			^ static_cast<std::uint32_t>(sample) * 83492791u;
+		hash ^= hash >> 16;
+		hash *= 0x7feb352du;
+		hash ^= hash >> 15;
+		hash *= 0x846ca68bu;
+		hash ^= hash >> 16;
+		return (hash >> 8) * (1.0f / (1u << 24));
+	}
+}
+
+RayTracing::RayTracer::RayTracer(const std::list<std::shared_ptr<I_IntersectableShape>>& objectsOfScene)
+	: objectsOfScene_(objectsOfScene)
+	, hierarchy_(std::make_shared<BoundingVolumeHierarchy>(objectsOfScene_))
+	, sceneGeometry_(hierarchy_)
+	, objectsHaveMovedSinceLastFrame_(false)
+	, renderCheckerboard_(false)
+	, numberOfFramesRendered_(0)
+	, renderedRegion_{0, 0, 0, 0}
+	, maximumLightSamplesPerPoint_(DEFAULT_MAXIMUM_LIGHT_SAMPLES_PER_POINT)
+{
+}
+
+RayTracing::RayTracer::RayTracer(
+	const std::list<std::shared_ptr<I_IntersectableShape>>& objectsOfScene,
+	const std::shared_ptr<I_SceneGeometry>& sceneGeometry)
+	: objectsOfScene_(objectsOfScene)
+	, sceneGeometry_(sceneGeometry)
+	, objectsHaveMovedSinceLastFrame_(false)
+	, renderCheckerboard_(false)
+	, numberOfFramesRendered_(0)
+	, renderedRegion_{0, 0, 0, 0}
+	, maximumLightSamplesPerPoint_(DEFAULT_MAXIMUM_LIGHT_SAMPLES_PER_POINT)
+{
+}
+
+geometry::Grid2<raster::RGB> RayTracing::RayTracer::renderSceneGivenParameters(
+	const MathTypes::Vector<3, float>& eyePosition,
+	const MathTypes::Vector<3, float>& lightPosition,
+	RayTracing::ImagePlane& imagePlane)
+{
+	return renderSceneGivenParameters(eyePosition, std::vector<PointLight>{PointLight(lightPosition)}, imagePlane);
+}
+
+geometry::Grid2<raster::RGB> RayTracing::RayTracer::renderSceneGivenParameters(
+	const MathTypes::Vector<3, float>& eyePosition,
+	const std::vector<PointLight>& lights,
+	RayTracing::ImagePlane& imagePlane)
+{
+	PROFILE_SCOPE("RayTracer::renderSceneGivenParameters");
+	renderRegionGivenParameters(eyePosition, lights, imagePlane,
+		PixelRectangle{0, 0, imagePlane.screen.width(), imagePlane.screen.height()});
+	return imagePlane.screen;
+}
+
+geometry::Grid2<raster::RGB> RayTracing::RayTracer::renderRegionGivenParameters(
+	const MathTypes::Vector<3, float>& eyePosition,
+	const std::vector<PointLight>& lights,
+	RayTracing::ImagePlane& imagePlane,
+	const PixelRectangle& region)
+{
+	PROFILE_SCOPE("RayTracer::renderRegionGivenParameters");
+	assert(region.x >= 0 && region.y >= 0 && region.width > 0 && region.height > 0);
+	assert(region.x + region.width <= imagePlane.screen.width() && region.y + region.height <= imagePlane.screen.height());
+
+	if(objectsHaveMovedSinceLastFrame_)
+	{
+		sceneGeometry_->update();
+		objectsHaveMovedSinceLastFrame_ = false;
+	}
+	lights_ = lights;
+	lightGrid_ = LightGrid(lights_);
+	if(irradianceCache_)
+	{
+		irradianceCache_->prepareForLights(lights_);
+	}
+
+	renderedRegion_ = region;
+	geometryBuffer_.resize(region.width, region.height);
+
+	boundedObjects_.clear();
+	for(const auto& object : objectsOfScene_)
+	{
+		boundedObjects_.push_back(BoundedObject{object.get(), object->boundingBox().expandedBy(BOUNDS_PADDING)});
+	}
+
+	//Alternate which half of the pixels is traced so that consecutive frames cover every pixel between them. The
+	//pattern is fixed to the whole image, so that neighbouring regions continue it.
+	const int parityOfTracedPixels = numberOfFramesRendered_ % 2;
+	//Tiles are laid out over the whole image, like the checkerboard pattern, and cut down to the region
+	const int regionEndX = region.x + region.width;
+	const int regionEndY = region.y + region.height;
+	for(int tileX = region.x - region.x % TILE_SIZE; tileX < regionEndX; tileX += TILE_SIZE)
+	{
+		for(int tileY = region.y - region.y % TILE_SIZE; tileY < regionEndY; tileY += TILE_SIZE)
+		{
+			const int firstX = std::max(tileX, region.x);
+			const int firstY = std::max(tileY, region.y);
+			const PixelRectangle tile{
+				firstX,
+				firstY,
+				std::min(tileX + TILE_SIZE, regionEndX) - firstX,
+				std::min(tileY + TILE_SIZE, regionEndY) - firstY};
+			findCandidatesOfTile(eyePosition, imagePlane, tile);
+			if(candidatesOfTile_.empty())
+			{
+				fillTileWithBackground(tile);
+				continue;
+			}
+
+			cameraRays_.generate(imagePlane, eyePosition, tile.x, tile.y, tile.width, tile.height);
+			for(int x = tile.x; x < tile.x + tile.width; x++)
+			{
+				for(int y = tile.y; y < tile.y + tile.height; y++)
+				{
+					if(renderCheckerboard_ && (x + y) % 2 != parityOfTracedPixels)
+					{
+						continue;
+					}
+					traceHitThroughPixel(x, y, cameraRays_.ray((x - tile.x) * tile.height + (y - tile.y)));
+				}
+			}
+			//Shading a tile at a time keeps the batch small enough to stay in cache
+			shadeBatchedHits(eyePosition);
+		}
+	}
+
+	if(renderCheckerboard_)
+	{
+		reconstructUntracedPixels((parityOfTracedPixels + region.x + region.y) % 2);
+	}
+
+	geometry::Grid2<raster::RGB> regionImage(region.width, region.height);
+	for(int x = 0; x < region.width; x++)
+	{
+		for(int y = 0; y < region.height; y++)
+		{
+			regionImage({x, y}) = raster::convertToRGB(geometryBuffer_(x, y).colour);
+			imagePlane.screen({region.x + x, region.y + y}) = regionImage({x, y});
+		}
+	}
+	numberOfFramesRendered_++;
+	return regionImage;
+}
+
+void RayTracing::RayTracer::transformObject(
+	const std::shared_ptr<I_IntersectableShape>& object,
+	const MathTypes::Matrix<4, 4, float>& transformationMatrix)
+{
+	assert(std::find(std::begin(objectsOfScene_), std::end(objectsOfScene_), object) != std::end(objectsOfScene_));
+
+	object->transform(transformationMatrix);
+	objectsHaveMovedSinceLastFrame_ = true;
+	if(irradianceCache_)
+	{
+		irradianceCache_->clear();
+	}
+}
+
+RayTracing::BoundingVolumeHierarchy::Statistics RayTracing::RayTracer::hierarchyStatistics() const
+{
+	return hierarchy_ != NULL ? hierarchy_->statistics() : BoundingVolumeHierarchy::Statistics();
+}
+
+void RayTracing::RayTracer::setMaximumLightSamplesPerPoint(int maximumLightSamplesPerPoint)
+{
+	assert(maximumLightSamplesPerPoint > 0);
+	maximumLightSamplesPerPoint_ = maximumLightSamplesPerPoint;
+}
+
+void RayTracing::RayTracer::enableIrradianceCache(float cellSize)
+{
+	irradianceCache_.emplace(cellSize);
+}
+
+void RayTracing::RayTracer::disableIrradianceCache()
+{
+	irradianceCache_ = std::nullopt;
+}
+
+const RayTracing::GeometryBuffer& RayTracing::RayTracer::geometryBuffer() const
+{
+	return geometryBuffer_;
+}
+
+void RayTracing::RayTracer::enableCheckerboardRendering()
+{
+	renderCheckerboard_ = true;
+}
+
+void RayTracing::RayTracer::disableCheckerboardRendering()
+{
+	renderCheckerboard_ = false;
+}
+
+std::optional<MathTypes::Vector<3, float>> RayTracing::RayTracer::determineClosestIntersectionPoint(
+	I_IntersectableShape** closestIntersectedShape,
+	const Ray& ray) const
+{
+	return sceneGeometry_->closestIntersectionPoint(closestIntersectedShape, ray);
+}
+
+std::optional<MathTypes::Vector<3, float>> RayTracing::RayTracer::closestIntersectionPointAmongCandidates(
+	I_IntersectableShape** closestIntersectedShape,
+	const Ray& ray) const
+{
+	if(static_cast<int>(candidatesOfTile_.size()) > MAXIMUM_CANDIDATES_TESTED_DIRECTLY)
+	{
+		return determineClosestIntersectionPoint(closestIntersectedShape, ray);
+	}
+
+	const auto direction = ray.direction();
+	const MathTypes::Vector<3, float> inverseDirection(1 / direction.xValue(), 1 / direction.yValue(), 1 / direction.zValue());
+	std::optional<MathTypes::Vector<3, float>> closestIntersectionPoint;
+	float closestDistance = std::numeric_limits<float>::infinity();
+	float closestDistanceSquared = std::numeric_limits<float>::infinity();
+	for(const auto& candidate : candidatesOfTile_)
+	{
+		if(!candidate.bounds.entryDistance(ray, inverseDirection, closestDistance))
+		{
+			continue;
+		}
+		auto intersectionPoint = candidate.object->closestIntersectionPoint(ray);
+		if(!intersectionPoint)
+		{
+			continue;
+		}
+		const float distanceSquared = LinearMath::distanceBetweenPointsSquared(ray.origin(), *intersectionPoint);
+		if(distanceSquared < closestDistanceSquared)
+		{
+			*closestIntersectedShape = candidate.object;
+			closestIntersectionPoint = intersectionPoint;
+			closestDistanceSquared = distanceSquared;
+			closestDistance = std::sqrt(distanceSquared);
+		}
+	}
+	return closestIntersectionPoint;
+}
+
+void RayTracing::RayTracer::findCandidatesOfTile(
+	const MathTypes::Vector<3, float>& eyePosition,
+	const RayTracing::ImagePlane& imagePlane,
+	const PixelRectangle& tile)
+{
+	//The primary rays of the tile start at the points of its pixels, so the frustum through its corner pixels
+	//holds all of them
+	const int lastX = tile.x + tile.width - 1;
+	const int lastY = tile.y + tile.height - 1;
+	const Frustum frustumOfTile(eyePosition, {
+		imagePlane.pixelTo3D(tile.x, tile.y),
+		imagePlane.pixelTo3D(lastX, tile.y),
+		imagePlane.pixelTo3D(lastX, lastY),
+		imagePlane.pixelTo3D(tile.x, lastY)});
+
+	candidatesOfTile_.clear();
+	for(const auto& boundedObject : boundedObjects_)
+	{
+		if(frustumOfTile.mayOverlap(boundedObject.bounds))
+		{
+			candidatesOfTile_.push_back(boundedObject);
+		}
+	}
+}
+
+void RayTracing::RayTracer::fillTileWithBackground(const PixelRectangle& tile)
+{
+	for(int x = tile.x; x < tile.x + tile.width; x++)
+	{
+		for(int y = tile.y; y < tile.y + tile.height; y++)
+		{
+			auto& sample = geometryBuffer_(x - renderedRegion_.x, y - renderedRegion_.y);
+			sample = GeometryBuffer::Sample();
+			sample.colour = BACKGROUND_COLOUR;
+		}
+	}
+}
+
+void RayTracing::RayTracer::traceHitThroughPixel(int x, int y, const Ray& rayFromImagePlane)
+{
+	I_IntersectableShape* closestIntersectedShape = NULL;
+	auto closestIntersectionPointOfAllObjects = closestIntersectionPointAmongCandidates(
+		&closestIntersectedShape, rayFromImagePlane);
+
+	auto& sample = geometryBuffer_(x - renderedRegion_.x, y - renderedRegion_.y);
+	sample = GeometryBuffer::Sample();
+	sample.colour = BACKGROUND_COLOUR;
+	if(closestIntersectedShape == NULL)
+	{
+		return;
+	}
+
+	//The shape's own test of whether the point is on its surface can reject a point its intersection test found,
+	//in which case there is no normal to shade with, and the pixel is left as background
+	const auto surfaceNormal = closestIntersectedShape->surfaceNormalAtPoint(*closestIntersectionPointOfAllObjects);
+	if(!surfaceNormal)
+	{
+		return;
+	}
+
+	sample.object = closestIntersectedShape;
+	sample.depth = LinearMath::distanceBetweenPoints(rayFromImagePlane.origin(), *closestIntersectionPointOfAllObjects);
+	sample.normal = GLUtility::Normal<float>(*surfaceNormal);
+
+	const int hit = shadingBatch_.addHit(
+		*closestIntersectionPointOfAllObjects, *surfaceNormal, closestIntersectedShape->colourOfShape());
+	pixelsOfBatchedHits_.push_back(Pixel{x - renderedRegion_.x, y - renderedRegion_.y});
+	addLightSamplesOfHit(hit, x, y);
+}
+
+void RayTracing::RayTracer::addLightSamplesOfHit(int hit, int x, int y)
+{
+	const auto point = shadingBatch_.point(hit);
+	lightGrid_.lightsReachingPoint(point, &lightsReachingHit_);
+
+	if(static_cast<int>(lightsReachingHit_.size()) <= maximumLightSamplesPerPoint_)
+	{
+		for(int light : lightsReachingHit_)
+		{
+			const auto& pointLight = lights_[light];
+			const float falloff = pointLight.falloffAtDistance(LinearMath::distanceBetweenPoints(point, pointLight.position));
+			shadingBatch_.addLightSample(hit, pointLight.position, pointLight.intensity * falloff);
+			lightsOfBatchedSamples_.push_back(light);
+		}
+		return;
+	}
+
+	//Too many lights to shadow test them all. Choose lights with probability p in proportion to the light they
+	//would contribute before shadowing, and weight each of the n choices by 1/(np). The contribution over p is the
+	//same for every light, the total of all contributions, so every sample is weighted by total/n.
+	cumulativeLightReachingHit_.clear();
+	float totalLight = 0;
+	for(int light : lightsReachingHit_)
+	{
+		const auto& pointLight = lights_[light];
+		totalLight += pointLight.intensity
+			* pointLight.falloffAtDistance(LinearMath::distanceBetweenPoints(point, pointLight.position));
+		cumulativeLightReachingHit_.push_back(totalLight);
+	}
+
+	const float lightScale = totalLight / maximumLightSamplesPerPoint_;
+	for(int sample = 0; sample < maximumLightSamplesPerPoint_; sample++)
+	{
+		const float target = randomFraction(x, y, sample) * totalLight;
+		const int chosen = std::min<int>(
+			std::upper_bound(std::begin(cumulativeLightReachingHit_), std::end(cumulativeLightReachingHit_), target)
+				- std::begin(cumulativeLightReachingHit_),
+			lightsReachingHit_.size() - 1);
+		const int light = lightsReachingHit_[chosen];
+		shadingBatch_.addLightSample(hit, lights_[light].position, lightScale);
+		lightsOfBatchedSamples_.push_back(light);
+	}
+}
+
+void RayTracing::RayTracer::shadeBatchedHits(const MathTypes::Vector<3, float>& eyePosition)
+{
+	PROFILE_SCOPE("RayTracer::shadeBatchedHits");
+	shadingBatch_.calculateDirectionsAndDiffuseLight(eyePosition);
+	for(int sample = 0; sample < shadingBatch_.numberOfLightSamples(); sample++)
+	{
+		const int hit = shadingBatch_.hitOfLightSample(sample);
+		auto viewIndependentLight = determineViewIndependentLightAtPoint(
+			shadingBatch_.point(hit), shadingBatch_.surfaceNormal(hit), shadingBatch_.pointToLight(sample),
+			shadingBatch_.diffuseLight(sample), lightsOfBatchedSamples_[sample]);
+		shadingBatch_.setDiffuseLight(sample, viewIndependentLight.diffuseComponent);
+		shadingBatch_.setPointIsLit(sample, viewIndependentLight.pointIsLit);
+	}
+	shadingBatch_.shade();
+
+	for(int i = 0; i < shadingBatch_.numberOfHits(); i++)
+	{
+		auto& sample = geometryBuffer_(pixelsOfBatchedHits_[i].x, pixelsOfBatchedHits_[i].y);
+		sample.colour = shadingBatch_.shadedColour(i);
+		if(sample.object->surfaceIsReflective())
+		{
+			auto surfaceNormal = shadingBatch_.surfaceNormal(i);
+			auto pointToEye = shadingBatch_.pointToEye(i);
+			auto reflectionFromEye = 2 * LinearMath::dotProduct(pointToEye, surfaceNormal) 
+												* (surfaceNormal - pointToEye);
+
+			RayTracing::Ray reflectionRay(shadingBatch_.point(i) + 0.1*reflectionFromEye, reflectionFromEye);
+			sample.colour = reflectedColourFromRay(sample.colour, reflectionRay, 0);
+		}
+	}
+
+	shadingBatch_.clear();
+	pixelsOfBatchedHits_.clear();
+	lightsOfBatchedSamples_.clear();
+}
+
+void RayTracing::RayTracer::reconstructUntracedPixels(int parityOfTracedPixels)
+{
+	//Every neighbour of an untraced pixel was traced. Interpolate along whichever of the horizontal and vertical
+	//neighbour pairs lies on a single surface, preferring the one with the smaller change in depth, so that
+	//edges are followed rather than blurred across.
+	const int width = geometryBuffer_.width();
+	const int height = geometryBuffer_.height();
+	for(int x = 0; x < width; x++)
+	{
+		for(int y = 0; y < height; y++)
+		{
+			if((x + y) % 2 == parityOfTracedPixels)
+			{
+				continue;
+			}
+
+			std::optional<GeometryBuffer::Sample> horizontalInterpolation;
+			std::optional<GeometryBuffer::Sample> verticalInterpolation;
+			float horizontalDepthChange = 0;
+			float verticalDepthChange = 0;
+			if(x > 0 && x < width - 1 && samplesLieOnSameSurface(geometryBuffer_(x - 1, y), geometryBuffer_(x + 1, y)))
+			{
+				horizontalInterpolation = averageOfSamples(geometryBuffer_(x - 1, y), geometryBuffer_(x + 1, y));
+				horizontalDepthChange = std::abs(geometryBuffer_(x - 1, y).depth - geometryBuffer_(x + 1, y).depth);
+			}
+			if(y > 0 && y < height - 1 && samplesLieOnSameSurface(geometryBuffer_(x, y - 1), geometryBuffer_(x, y + 1)))
+			{
+				verticalInterpolation = averageOfSamples(geometryBuffer_(x, y - 1), geometryBuffer_(x, y + 1));
+				verticalDepthChange = std::abs(geometryBuffer_(x, y - 1).depth - geometryBuffer_(x, y + 1).depth);
+			}
+
+			if(horizontalInterpolation && (!verticalInterpolation || horizontalDepthChange <= verticalDepthChange))
+			{
+				geometryBuffer_(x, y) = *horizontalInterpolation;
+			}
+			else if(verticalInterpolation)
+			{
+				geometryBuffer_(x, y) = *verticalInterpolation;
+			}
+			else
+			{
+				//On an edge or corner. Copy the nearest neighbour so that the pixel takes one side of the edge
+				//instead of a blend of both.
+				const int neighbourOffsets[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+				const GeometryBuffer::Sample* nearestNeighbour = NULL;
+				for(const auto& offset : neighbourOffsets)
+				{
+					const int neighbourX = x + offset[0];
+					const int neighbourY = y + offset[1];
+					if(neighbourX < 0 || neighbourX >= width || neighbourY < 0 || neighbourY >= height)
+					{
+						continue;
+					}
+					const auto& neighbour = geometryBuffer_(neighbourX, neighbourY);
+					if(nearestNeighbour == NULL || neighbour.depth < nearestNeighbour->depth)
+					{
+						nearestNeighbour = &neighbour;
+					}
+				}
+				if(nearestNeighbour != NULL)
+				{
+					geometryBuffer_(x, y) = *nearestNeighbour;
+				}
+			}
+		}
+	}
+}
+
+bool RayTracing::RayTracer::rayIntersectsAnObject(const Ray& ray, float maximumDistance) const
+{
+	return sceneGeometry_->rayIntersectsAnObject(ray, maximumDistance);
+}
+
+RayTracing::IrradianceCache::Entry RayTracing::RayTracer::determineViewIndependentLightAtPoint(
+	const MathTypes::Vector<3, float>& point,
+	const MathTypes::Vector<3, float>& surfaceNormal,
+	const MathTypes::Vector<3, float>& pointToLight,
+	float diffuseComponent,
+	int light)
+{
+	//Diffuse lighting and shadowing don't depend on where the eye is, so they can be reused between frames
+	if(irradianceCache_)
+	{
+		auto cachedLight = irradianceCache_->lookup(point, surfaceNormal, light);
+		if(cachedLight)
+		{
+			return *cachedLight;
+		}
+	}
+
+	//Only objects between the point and the light cast a shadow. A light of infinite reach is shadowed by anything
+	//along the ray, as the single light the ray tracer started with always was.
+	RayTracing::Ray rayToLight(point + 0.1*pointToLight, pointToLight);
+	const float distanceToLight = std::isinf(lights_[light].radius)
+		? std::numeric_limits<float>::infinity()
+		: LinearMath::distanceBetweenPoints(rayToLight.origin(), lights_[light].position);
+	IrradianceCache::Entry viewIndependentLight{diffuseComponent, !rayIntersectsAnObject(rayToLight, distanceToLight)};
+	if(irradianceCache_)
+	{
+		irradianceCache_->insert(point, surfaceNormal, light, viewIndependentLight);
+	}
+	return viewIndependentLight;
+}
+
+GLUtility::Colour<float> RayTracing::RayTracer::reflectedColourFromRay(
+	const GLUtility::Colour<float> initialColour,
+	const Ray& reflectionRay,
+	int levelOfReflectionRecursion) const
+{
+	I_IntersectableShape* closestReflectingShape = NULL;
+	auto closestReflectionPointOfAllObjects = determineClosestIntersectionPoint(&closestReflectingShape, reflectionRay);
+
+	auto outputColour = initialColour;
+	if(closestReflectingShape != NULL && levelOfReflectionRecursion < 10)
+	{
+		outputColour = outputColour * closestReflectingShape->colourOfShape();
+
+		//Without a normal at the point there is nothing to reflect about, so the surface is treated as not reflective
+		auto surfaceNormalOrNothing = closestReflectingShape->surfaceIsReflective()
+			? closestReflectingShape->surfaceNormalAtPoint(*closestReflectionPointOfAllObjects)
+			: std::nullopt;
+		if(surfaceNormalOrNothing)
+		{
+			const auto surfaceNormal = *surfaceNormalOrNothing;
+			auto reflectionVector = (*closestReflectionPointOfAllObjects - reflectionRay.origin()).normalized();
+			auto reflectedReflectionVector = 2 * LinearMath::dotProduct(reflectionVector, surfaceNormal) 
+														  * (surfaceNormal - reflectionVector);
+
+			outputColour = reflectedColourFromRay(
+				outputColour, 
+				RayTracing::Ray(*closestReflectionPointOfAllObjects + 0.1*reflectedReflectionVector, reflectedReflectionVector),
+				levelOfReflectionRecursion+1);
+		}
+	}
+	return outputColour;
 }
\ No newline at end of file
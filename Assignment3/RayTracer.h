@@ -1,72 +1,192 @@
-#pragma once
-
-#include <list>
-#include <memory>
-#include <optional>
-
-#include "Ray.h"
-
-namespace RayTracing
-{
-	class I_IntersectableShape;
-	class ImagePlane;
-}
-
-namespace geometry
-{
-	template<typename T> class Grid2;
-}
-
-namespace raster
-{
-	struct RGB;
-}
-
-namespace MathTypes
-{
-	template<int dimensions, typename CoordinatePrimitive> class Vector;
-}
-
-namespace GLUtility
-{
-	template<typename ColourPrimitive> class Colour;
-}
-
-namespace RayTracing
-{
-	class RayTracer
-	{
-		public:
-			RayTracer(const std::list<std::shared_ptr<I_IntersectableShape>>& objectsOfScene);
-			~RayTracer() = default;
-
-			geometry::Grid2<raster::RGB> renderSceneGivenParameters(
-				const MathTypes::Vector<3, float>& eyePosition,
-				const MathTypes::Vector<3, float>& lightPosition,
-				RayTracing::ImagePlane& imagePlane);
-
-		private:
-			std::optional<MathTypes::Vector<3, float>> determineClosestIntersectionPoint(
-				I_IntersectableShape** closestIntersectedShape,
-				const Ray& ray) const;
-			bool rayIntersectsAnObject(const Ray& ray) const;
-			float determineTotalLightAtPoint(
-				const MathTypes::Vector<3, float>& point,
-				const MathTypes::Vector<3, float>& surfaceNormal,
-				const MathTypes::Vector<3, float>& pointToLight,
-				const MathTypes::Vector<3, float>& pointToEye) const;
-			GLUtility::Colour<float> determineColourAtPoint(
-				float lightAtPoint,
-				const MathTypes::Vector<3, float>& point,
-				const MathTypes::Vector<3, float>& surfaceNormal,
-				const MathTypes::Vector<3, float>& pointToEye,
-				const I_IntersectableShape* shapeThatPointLiesOn) const;
-			GLUtility::Colour<float> reflectedColourFromRay(
-				const GLUtility::Colour<float> initialColour,
-				const Ray& reflectionRay,
-				int levelOfReflectionRecursion) const;
-
-		private:
-			std::list<std::shared_ptr<I_IntersectableShape>> objectsOfScene_;
-	};
+#pragma once
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "assignmentSpecific/BatchShading.h"
+#include "assignmentSpecific/BoundingBox.h"
+#include "assignmentSpecific/BoundingVolumeHierarchy.h"
+#include "assignmentSpecific/CameraRays.h"
+#include "assignmentSpecific/GeometryBuffer.h"
+#include "assignmentSpecific/I_SceneGeometry.h"
+#include "assignmentSpecific/IrradianceCache.h"
+#include "assignmentSpecific/LightGrid.h"
+#include "assignmentSpecific/PointLight.h"
+#include "Ray.h"
+
+namespace RayTracing
+{
+	class I_IntersectableShape;
+	class ImagePlane;
+}
+
+namespace geometry
+{
+	template<typename T> class Grid2;
+}
+
+namespace raster
+{
+	struct RGB;
+}
+
+namespace MathTypes
+{
+	template<int rows, int columns, typename CoordinatePrimitive> class Matrix;
+	template<int dimensions, typename CoordinatePrimitive> class Vector;
+}
+
+namespace GLUtility
+{
+	template<typename ColourPrimitive> class Colour;
+}
+
+namespace RayTracing
+{
+	class RayTracer
+	{
+		public:
+			struct PixelRectangle
+			{
+				int x;
+				int y;
+				int width;
+				int height;
+			};
+
+			//Builds a bounding volume hierarchy over the objects, which may be of any shape
+			RayTracer(const std::list<std::shared_ptr<I_IntersectableShape>>& objectsOfScene);
+			//Uses geometry that has already been prepared for the objects, such as a StaticScene
+			RayTracer(
+				const std::list<std::shared_ptr<I_IntersectableShape>>& objectsOfScene,
+				const std::shared_ptr<I_SceneGeometry>& sceneGeometry);
+			~RayTracer() = default;
+
+			static const int DEFAULT_MAXIMUM_LIGHT_SAMPLES_PER_POINT = 16;
+
+			//Lights the scene with a single light that reaches everywhere
+			geometry::Grid2<raster::RGB> renderSceneGivenParameters(
+				const MathTypes::Vector<3, float>& eyePosition,
+				const MathTypes::Vector<3, float>& lightPosition,
+				RayTracing::ImagePlane& imagePlane);
+			//Each shaded point is only lit by, and only casts shadow rays towards, the lights whose radius it lies in
+			geometry::Grid2<raster::RGB> renderSceneGivenParameters(
+				const MathTypes::Vector<3, float>& eyePosition,
+				const std::vector<PointLight>& lights,
+				RayTracing::ImagePlane& imagePlane);
+			//Only traces the pixels of the image plane within the region, which must lie inside its screen, with
+			//the same camera as the whole image. The traced pixels are written into the screen, leaving the rest
+			//of it untouched, so that regions rendered one after another build up the whole image; they are also
+			//returned as an image of their own. The geometry buffer only covers the region. Pixels match those of
+			//a full render, except that checkerboard reconstruction has no neighbours outside the region to use.
+			//The region is traced in tiles, and only the objects that a tile's frustum overlaps are tested
+			//against its primary rays; tiles that overlap none are filled with the background without tracing.
+			geometry::Grid2<raster::RGB> renderRegionGivenParameters(
+				const MathTypes::Vector<3, float>& eyePosition,
+				const std::vector<PointLight>& lights,
+				RayTracing::ImagePlane& imagePlane,
+				const PixelRectangle& region);
+
+			//Points reached by more lights than this are lit by that many lights chosen at random, each in
+			//proportion to the light it would contribute, and weighted so that the light is right on average. The
+			//choice depends only on the pixel, so images are reproducible, but they get noisier the more lights
+			//are skipped.
+			void setMaximumLightSamplesPerPoint(int maximumLightSamplesPerPoint);
+
+			//Animation support. Moves an object of the scene; the bounding hierarchy is refit (or rebuilt, if
+			//refitting has degraded it too much) before the next frame is rendered.
+			void transformObject(
+				const std::shared_ptr<I_IntersectableShape>& object,
+				const MathTypes::Matrix<4, 4, float>& transformationMatrix);
+			//Empty if the ray tracer was given its scene geometry
+			BoundingVolumeHierarchy::Statistics hierarchyStatistics() const;
+
+			//Reuses diffuse lighting and shadow visibility across frames for surface points that lie within the
+			//same cellSize wide cell of world space. Cached lighting is discarded whenever the light or an object
+			//moves, so this only pays off for static scenes with a static light.
+			void enableIrradianceCache(float cellSize);
+			void disableIrradianceCache();
+
+			//Preview mode that only traces every other pixel, in a checkerboard pattern that alternates between
+			//frames, and reconstructs the pixels in between from their traced neighbours. Roughly halves the
+			//number of primary rays at the cost of detail along object edges.
+			void enableCheckerboardRendering();
+			void disableCheckerboardRendering();
+
+			//What the primary rays of the last frame hit, for post processing such as denoising. Pixel (0, 0) is
+			//the top left of the rendered region.
+			const GeometryBuffer& geometryBuffer() const;
+
+		private:
+			struct Pixel
+			{
+				int x;
+				int y;
+			};
+
+			struct BoundedObject
+			{
+				I_IntersectableShape* object;
+				BoundingBox bounds;
+			};
+
+			std::optional<MathTypes::Vector<3, float>> determineClosestIntersectionPoint(
+				I_IntersectableShape** closestIntersectedShape,
+				const Ray& ray) const;
+			//Primary rays only test the objects that the frustum of their tile overlaps
+			std::optional<MathTypes::Vector<3, float>> closestIntersectionPointAmongCandidates(
+				I_IntersectableShape** closestIntersectedShape,
+				const Ray& ray) const;
+			//x and y of the tile are in pixels of the whole image
+			void findCandidatesOfTile(
+				const MathTypes::Vector<3, float>& eyePosition,
+				const RayTracing::ImagePlane& imagePlane,
+				const PixelRectangle& tile);
+			void fillTileWithBackground(const PixelRectangle& tile);
+			//Primary rays are traced first and their hits collected, then the hits are lit together
+			//x and y are in pixels of the whole image
+			void traceHitThroughPixel(int x, int y, const Ray& rayFromImagePlane);
+			void addLightSamplesOfHit(int hit, int x, int y);
+			void shadeBatchedHits(const MathTypes::Vector<3, float>& eyePosition);
+			//Parity of x + y of the traced pixels, in pixels of the geometry buffer
+			void reconstructUntracedPixels(int parityOfTracedPixels);
+			bool rayIntersectsAnObject(const Ray& ray, float maximumDistance) const;
+			IrradianceCache::Entry determineViewIndependentLightAtPoint(
+				const MathTypes::Vector<3, float>& point,
+				const MathTypes::Vector<3, float>& surfaceNormal,
+				const MathTypes::Vector<3, float>& pointToLight,
+				float diffuseComponent,
+				int light);
+			GLUtility::Colour<float> reflectedColourFromRay(
+				const GLUtility::Colour<float> initialColour,
+				const Ray& reflectionRay,
+				int levelOfReflectionRecursion) const;
+
+		private:
+			std::list<std::shared_ptr<I_IntersectableShape>> objectsOfScene_;
+			std::shared_ptr<BoundingVolumeHierarchy> hierarchy_;
+			std::shared_ptr<I_SceneGeometry> sceneGeometry_;
+			bool objectsHaveMovedSinceLastFrame_;
+			std::optional<IrradianceCache> irradianceCache_;
+			bool renderCheckerboard_;
+			int numberOfFramesRendered_;
+			PixelRectangle renderedRegion_;
+			GeometryBuffer geometryBuffer_;
+			CameraRays cameraRays_;
+			//Every object of the scene with its bounding box, gathered once per frame, and those of them that the
+			//tile being traced can see
+			std::vector<BoundedObject> boundedObjects_;
+			std::vector<BoundedObject> candidatesOfTile_;
+			std::vector<PointLight> lights_;
+			LightGrid lightGrid_;
+			int maximumLightSamplesPerPoint_;
+			ShadingBatch shadingBatch_;
+			std::vector<Pixel> pixelsOfBatchedHits_;
+			std::vector<int> lightsOfBatchedSamples_;
+			//Scratch space for addLightSamplesOfHit(), kept to avoid allocating for every hit
+			std::vector<int> lightsReachingHit_;
+			std::vector<float> cumulativeLightReachingHit_;
+	};
 }
\ No newline at end of file
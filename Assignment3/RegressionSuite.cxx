@@ -0,0 +1,220 @@
+#include "assignmentSpecific/RegressionSuite.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+
+#include "assignmentSpecific/TutorialLibraries/grid2.h"
+#include "assignmentSpecific/TutorialLibraries/image.h"
+
+#include "assignmentSpecific/ImageFiles.h"
+
+namespace
+{
+	struct Resolution
+	{
+		int width;
+		int height;
+	};
+
+	const Resolution RESOLUTIONS[] = {{160, 120}, {320, 240}, {640, 480}};
+	const std::string TIMINGS_FILE_NAME = "timings.txt";
+
+#if defined(_GLIBCXX_ASSERTIONS) || defined(_GLIBCXX_DEBUG)
+	const bool BUILT_WITH_ASSERTIONS = true;
+#else
+	const bool BUILT_WITH_ASSERTIONS = false;
+#endif
+
+	std::string resolutionName(const Resolution& resolution)
+	{
+		return std::to_string(resolution.width) + "x" + std::to_string(resolution.height);
+	}
+
+	std::string referenceImageFileName(const std::string& directory, const std::string& sceneName, const Resolution& resolution)
+	{
+		return directory + "/" + sceneName + "_" + resolutionName(resolution) + ".ppm";
+	}
+
+	//Keyed by "<scene> <width>x<height>"
+	std::map<std::string, double> readTimings(const std::string& fileName)
+	{
+		std::map<std::string, double> timings;
+		std::ifstream file(fileName);
+		std::string sceneName, resolution;
+		double milliseconds;
+		while(file >> sceneName >> resolution >> milliseconds)
+		{
+			timings[sceneName + " " + resolution] = milliseconds;
+		}
+		return timings;
+	}
+
+	bool writeTimings(const std::string& fileName, const std::map<std::string, double>& timings)
+	{
+		std::ofstream file(fileName);
+		for(const auto& timing : timings)
+		{
+			file << timing.first << " " << timing.second << "\n";
+		}
+		return static_cast<bool>(file);
+	}
+
+	//Number of pixels with a channel that differs by more than the tolerance, or -1 if the sizes differ
+	int numberOfDifferingPixels(
+		const geometry::Grid2<raster::RGB>& image,
+		const geometry::Grid2<raster::RGB>& reference,
+		int channelTolerance)
+	{
+		if(image.width() != reference.width() || image.height() != reference.height())
+		{
+			return -1;
+		}
+
+		int differingPixels = 0;
+		for(int y = 0; y < image.height(); y++)
+		{
+			for(int x = 0; x < image.width(); x++)
+			{
+				const auto a = image({x, y});
+				const auto b = reference({x, y});
+				const int difference = std::max({std::abs(a.r - b.r), std::abs(a.g - b.g), std::abs(a.b - b.b)});
+				if(difference > channelTolerance)
+				{
+					differingPixels++;
+				}
+			}
+		}
+		return differingPixels;
+	}
+}
+
+bool RegressionSuite::run(const std::vector<std::string>& sceneNames, const RenderFunctionFactory& prepareRender, const Settings& settings)
+{
+	const std::string timingsFileName = settings.referenceDirectory + "/" + TIMINGS_FILE_NAME;
+	auto baselineTimings = readTimings(timingsFileName);
+	std::map<std::string, double> newTimings;
+	bool allPassed = true;
+
+	for(const auto& sceneName : sceneNames)
+	{
+		for(const auto& resolution : RESOLUTIONS)
+		{
+			const std::string name = sceneName + " " + resolutionName(resolution);
+			auto render = prepareRender(sceneName, resolution.width, resolution.height);
+
+			double fastestRender = std::numeric_limits<double>::infinity();
+			geometry::Grid2<raster::RGB> image(resolution.width, resolution.height);
+			bool rendersDiffer = false;
+			for(int i = 0; i < std::max(2, settings.rendersPerTiming); i++)
+			{
+				const auto start = std::chrono::steady_clock::now();
+				auto nextImage = render();
+				const auto end = std::chrono::steady_clock::now();
+				fastestRender = std::min(fastestRender, std::chrono::duration<double, std::milli>(end - start).count());
+				rendersDiffer = rendersDiffer || (i > 0 && numberOfDifferingPixels(nextImage, image, 0) != 0);
+				image = nextImage;
+			}
+
+			std::ostringstream report;
+			report << std::fixed << std::setprecision(1) << name << ": " << fastestRender << " ms";
+			bool passed = true;
+			if(BUILT_WITH_ASSERTIONS)
+			{
+				report << " (checked build, timing not compared)";
+			}
+			else
+			{
+				newTimings[name] = fastestRender;
+			}
+			if(rendersDiffer)
+			{
+				report << ", renders differ from each other";
+				passed = false;
+			}
+			const auto referenceFileName = referenceImageFileName(settings.referenceDirectory, sceneName, resolution);
+			if(settings.updateReferences)
+			{
+				if(!ImageFiles::writePortablePixmap(referenceFileName, image))
+				{
+					report << ", failed to write " << referenceFileName;
+					passed = false;
+				}
+			}
+			else
+			{
+				if(!BUILT_WITH_ASSERTIONS)
+				{
+					auto baseline = baselineTimings.find(name);
+					if(baseline == std::end(baselineTimings))
+					{
+						report << ", no baseline timing";
+						passed = false;
+					}
+					else
+					{
+						const double slowdownPercentage = 100 * (fastestRender / baseline->second - 1);
+						report << " (baseline " << baseline->second << " ms, " << std::showpos << slowdownPercentage
+							<< std::noshowpos << "%)";
+						if(slowdownPercentage > settings.allowedSlowdownPercentage)
+						{
+							report << ", too slow";
+							passed = false;
+						}
+					}
+				}
+
+				geometry::Grid2<raster::RGB> reference(0, 0);
+				if(!ImageFiles::readPortablePixmap(referenceFileName, &reference))
+				{
+					report << ", no reference image " << referenceFileName;
+					passed = false;
+				}
+				else
+				{
+					const int differingPixels = numberOfDifferingPixels(image, reference, settings.channelTolerance);
+					const int allowedDifferingPixels =
+						settings.allowedFractionOfDifferingPixels * resolution.width * resolution.height;
+					if(differingPixels < 0)
+					{
+						report << ", reference image is a different size";
+						passed = false;
+					}
+					else
+					{
+						report << ", " << differingPixels << " pixels differ";
+						if(differingPixels > allowedDifferingPixels)
+						{
+							report << " (at most " << allowedDifferingPixels << " may)";
+							passed = false;
+						}
+					}
+				}
+			}
+
+			std::cout << (passed ? "[ OK ] " : "[FAIL] ") << report.str() << std::endl;
+			allPassed = allPassed && passed;
+		}
+	}
+
+	if(settings.updateReferences)
+	{
+		//Keep the baselines of scenes that were not rendered this time
+		for(const auto& timing : newTimings)
+		{
+			baselineTimings[timing.first] = timing.second;
+		}
+		if(!writeTimings(timingsFileName, baselineTimings))
+		{
+			std::cout << "[FAIL] Failed to write " << timingsFileName << std::endl;
+			allPassed = false;
+		}
+	}
+	return allPassed;
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace geometry
+{
+	template<typename T> class Grid2;
+}
+
+namespace raster
+{
+	struct RGB;
+}
+
+//Guards changes to the ray tracer against unintended changes to its output and its speed. Every scene is rendered
+//at each of several resolutions, and each image is compared to a reference image and its render time to a
+//baseline, both stored in a reference directory:
+//	<scene>_<width>x<height>.ppm	the reference image
+//	timings.txt						one "<scene> <width>x<height> <milliseconds>" line per render
+//Running with updateReferences set renders everything and overwrites the references with the results.
+//
+//Every render of a scene must also give exactly the same image, since a read of uninitialised memory shows up as
+//output that changes from run to run. The suite should be run from two builds: an optimised one, and one with the
+//standard library's checks enabled (-D_GLIBCXX_ASSERTIONS), which stops at reads of empty optionals and at out of
+//range indices. Timings of the checked build are meaningless, so there only the images are compared.
+namespace RegressionSuite
+{
+	struct Settings
+	{
+		std::string referenceDirectory;
+		bool updateReferences = false;
+		//Largest difference allowed in any colour channel of a pixel
+		int channelTolerance = 2;
+		//Reflections at grazing angles are sensitive to rounding, so a few pixels may exceed the tolerance
+		float allowedFractionOfDifferingPixels = 0.01;
+		//A render fails if it takes this many percent longer than its baseline
+		float allowedSlowdownPercentage = 10;
+		//Renders are repeated and the fastest is compared, to keep other load on the machine out of the timings. There
+		//are always at least two, so that they can be compared with each other.
+		int rendersPerTiming = 5;
+	};
+
+	//Prepares a scene for rendering at the given resolution, and returns a function that renders it. Only the
+	//returned function is timed, so building the scene and its acceleration structures is left out.
+	using RenderFunction = std::function<geometry::Grid2<raster::RGB>()>;
+	using RenderFunctionFactory = std::function<RenderFunction(const std::string& sceneName, int width, int height)>;
+
+	//Reports each render on standard output and returns true if none of them failed
+	bool run(const std::vector<std::string>& sceneNames, const RenderFunctionFactory& prepareRender, const Settings& settings);
+}
\ No newline at end of file
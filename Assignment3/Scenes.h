@@ -1,99 +1,182 @@
-#pragma once
-
-#include <list>
-#include <memory>
-
-#include "assignmentSpecific/IntersectableShape.h"
-#include "glUtility/Vertex.h"
-#include "math/Vector.h"
-#include "shapes/Quadrilateral.h"
-#include "shapes/Sphere.h"
-#include "shapes/Triangle.h"
-
-namespace Scenes
-{
-	std::list<std::shared_ptr<RayTracing::I_IntersectableShape>> simpleScene()
-	{
-		auto blueGreenSphere = new RayTracing::IntersectableShape<Shapes::Sphere<float>>(
-			GLUtility::Colour<float>(0.1, 0.8, 0.3), false, Shapes::Sphere<float>(10, MathTypes::Vector<3, float>(0, -10, -15)));
-
-		auto mirrorSurface = new RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<Shapes::Quadrilateral<3, float>>>(
-			GLUtility::Colour<float>(0.7, 0.7, 0.7), true, Shapes::Quadrilateral<3, float>(
-			MathTypes::Vector<3, float>(-40, -30, 40),
-			MathTypes::Vector<3, float>(40, -30, 40),
-			MathTypes::Vector<3, float>(-40, -30, -40),
-			MathTypes::Vector<3, float>(40, -30, -40)));
-
-		return std::list<std::shared_ptr<RayTracing::I_IntersectableShape>>({
-			std::shared_ptr<RayTracing::I_IntersectableShape>(blueGreenSphere), 
-			std::shared_ptr<RayTracing::I_IntersectableShape>(mirrorSurface)
-		});
-	}
-
-	std::list<std::shared_ptr<RayTracing::I_IntersectableShape>> mediumComplexityScene()
-	{
-		auto reflectiveRedSphere = new RayTracing::IntersectableShape<Shapes::Sphere<float>>(
-			GLUtility::Colour<float>(0.9, 0.1, 0.1), true, Shapes::Sphere<float>(10, MathTypes::Vector<3, float>(0, 0, 0)));
-
-		auto reflectiveMirrorSurface = new RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<Shapes::Quadrilateral<3, float>>>(
-		GLUtility::Colour<float>(0.8, 0.8, 0.8), true, Shapes::Quadrilateral<3, float>(
-			MathTypes::Vector<3, float>(0, -30, -40),
-			MathTypes::Vector<3, float>(40, -30, -20),
-			MathTypes::Vector<3, float>(0, 30, -40),
-			MathTypes::Vector<3, float>(40, 30, -20)));
-
-		auto tealSurface = new RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<Shapes::Quadrilateral<3, float>>>(
-			GLUtility::Colour<float>(0.1, .5, .5), false, Shapes::Quadrilateral<3, float>(
-			MathTypes::Vector<3, float>(-40, -30, 40),
-			MathTypes::Vector<3, float>(40, -30, 40),
-			MathTypes::Vector<3, float>(-40, -30, -40),
-			MathTypes::Vector<3, float>(40, -30, -40)));
-
-		return std::list<std::shared_ptr<RayTracing::I_IntersectableShape>>({
-			std::shared_ptr<RayTracing::I_IntersectableShape>(reflectiveRedSphere), 
-			std::shared_ptr<RayTracing::I_IntersectableShape>(reflectiveMirrorSurface),
-			std::shared_ptr<RayTracing::I_IntersectableShape>(tealSurface)
-		});
-	}
-
-	std::list<std::shared_ptr<RayTracing::I_IntersectableShape>> complexScene()
-	{
-		std::list<std::shared_ptr<RayTracing::I_IntersectableShape>> objectsInScene;
-		for(int i = -4; i <= 4; i++)
-		{
-			objectsInScene.push_back(std::shared_ptr<RayTracing::I_IntersectableShape>(
-				new RayTracing::IntersectableShape<Shapes::Sphere<float>>(
-						GLUtility::Colour<float>(0.7, 0.7, 0.7), true, 
-						Shapes::Sphere<float>(10, MathTypes::Vector<3, float>(20 * i, -30, 0)))
-				));
-			objectsInScene.push_back(std::shared_ptr<RayTracing::I_IntersectableShape>(
-				new RayTracing::IntersectableShape<Shapes::Sphere<float>>(
-						GLUtility::Colour<float>(0.7, 0.7, 0.7), true, 
-						Shapes::Sphere<float>(10, MathTypes::Vector<3, float>(20 * i, 20, -20)))
-				));
-		}
-		objectsInScene.push_back(std::shared_ptr<RayTracing::I_IntersectableShape>(
-			new RayTracing::IntersectableShape<Shapes::Sphere<float>>(
-				GLUtility::Colour<float>(0.1, 0.9, 0.9), false, 
-				Shapes::Sphere<float>(10, MathTypes::Vector<3, float>(0, -10, -10)))
-			));
-		objectsInScene.push_back(std::shared_ptr<RayTracing::I_IntersectableShape>(
-			new RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<Shapes::Quadrilateral<3, float>>>(
-				GLUtility::Colour<float>(0.5, 0.5, 0.5), true, Shapes::Quadrilateral<3, float>(
-				MathTypes::Vector<3, float>(-80, -30, -20),
-				MathTypes::Vector<3, float>(0, -30, -20),
-				MathTypes::Vector<3, float>(-80, 100, -20),
-				MathTypes::Vector<3, float>(0, 100, -20)))
-			));
-		objectsInScene.push_back(std::shared_ptr<RayTracing::I_IntersectableShape>(
-			new RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<Shapes::Quadrilateral<3, float>>>(
-				GLUtility::Colour<float>(0.9, 0.9, 0.5), true, Shapes::Quadrilateral<3, float>(
-				MathTypes::Vector<3, float>(0, -30, -20),
-				MathTypes::Vector<3, float>(80, -30, -20),
-				MathTypes::Vector<3, float>(0, 100, -20),
-				MathTypes::Vector<3, float>(80, 100, -20)))
-			));
-		
-		return objectsInScene;		
-	}
+#pragma once
+
+#include <list>
+#include <memory>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "assignmentSpecific/IntersectableShape.h"
+#include "assignmentSpecific/PointLight.h"
+#include "glUtility/Vertex.h"
+#include "math/Vector.h"
+#include "shapes/MengerSponge.h"
+#include "shapes/Quadrilateral.h"
+#include "shapes/Sphere.h"
+#include "shapes/SphereCloud.h"
+#include "shapes/Triangle.h"
+
+namespace Scenes
+{
+	std::list<std::shared_ptr<RayTracing::I_IntersectableShape>> simpleScene()
+	{
+		auto blueGreenSphere = new RayTracing::IntersectableShape<Shapes::Sphere<float>>(
+			GLUtility::Colour<float>(0.1, 0.8, 0.3), false, Shapes::Sphere<float>(10, MathTypes::Vector<3, float>(0, -10, -15)));
+
+		auto mirrorSurface = new RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<Shapes::Quadrilateral<3, float>>>(
+			GLUtility::Colour<float>(0.7, 0.7, 0.7), true, Shapes::Quadrilateral<3, float>(
+			MathTypes::Vector<3, float>(-40, -30, 40),
+			MathTypes::Vector<3, float>(40, -30, 40),
+			MathTypes::Vector<3, float>(-40, -30, -40),
+			MathTypes::Vector<3, float>(40, -30, -40)));
+
+		return std::list<std::shared_ptr<RayTracing::I_IntersectableShape>>({
+			std::shared_ptr<RayTracing::I_IntersectableShape>(blueGreenSphere), 
+			std::shared_ptr<RayTracing::I_IntersectableShape>(mirrorSurface)
+		});
+	}
+
+	std::list<std::shared_ptr<RayTracing::I_IntersectableShape>> mediumComplexityScene()
+	{
+		auto reflectiveRedSphere = new RayTracing::IntersectableShape<Shapes::Sphere<float>>(
+			GLUtility::Colour<float>(0.9, 0.1, 0.1), true, Shapes::Sphere<float>(10, MathTypes::Vector<3, float>(0, 0, 0)));
+
+		auto reflectiveMirrorSurface = new RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<Shapes::Quadrilateral<3, float>>>(
+		GLUtility::Colour<float>(0.8, 0.8, 0.8), true, Shapes::Quadrilateral<3, float>(
+			MathTypes::Vector<3, float>(0, -30, -40),
+			MathTypes::Vector<3, float>(40, -30, -20),
+			MathTypes::Vector<3, float>(0, 30, -40),
+			MathTypes::Vector<3, float>(40, 30, -20)));
+
+		auto tealSurface = new RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<Shapes::Quadrilateral<3, float>>>(
+			GLUtility::Colour<float>(0.1, .5, .5), false, Shapes::Quadrilateral<3, float>(
+			MathTypes::Vector<3, float>(-40, -30, 40),
+			MathTypes::Vector<3, float>(40, -30, 40),
+			MathTypes::Vector<3, float>(-40, -30, -40),
+			MathTypes::Vector<3, float>(40, -30, -40)));
+
+		return std::list<std::shared_ptr<RayTracing::I_IntersectableShape>>({
+			std::shared_ptr<RayTracing::I_IntersectableShape>(reflectiveRedSphere), 
+			std::shared_ptr<RayTracing::I_IntersectableShape>(reflectiveMirrorSurface),
+			std::shared_ptr<RayTracing::I_IntersectableShape>(tealSurface)
+		});
+	}
+
+	std::list<std::shared_ptr<RayTracing::I_IntersectableShape>> complexScene()
+	{
+		std::list<std::shared_ptr<RayTracing::I_IntersectableShape>> objectsInScene;
+		for(int i = -4; i <= 4; i++)
+		{
+			objectsInScene.push_back(std::shared_ptr<RayTracing::I_IntersectableShape>(
+				new RayTracing::IntersectableShape<Shapes::Sphere<float>>(
+						GLUtility::Colour<float>(0.7, 0.7, 0.7), true, 
+						Shapes::Sphere<float>(10, MathTypes::Vector<3, float>(20 * i, -30, 0)))
+				));
+			objectsInScene.push_back(std::shared_ptr<RayTracing::I_IntersectableShape>(
+				new RayTracing::IntersectableShape<Shapes::Sphere<float>>(
+						GLUtility::Colour<float>(0.7, 0.7, 0.7), true, 
+						Shapes::Sphere<float>(10, MathTypes::Vector<3, float>(20 * i, 20, -20)))
+				));
+		}
+		objectsInScene.push_back(std::shared_ptr<RayTracing::I_IntersectableShape>(
+			new RayTracing::IntersectableShape<Shapes::Sphere<float>>(
+				GLUtility::Colour<float>(0.1, 0.9, 0.9), false, 
+				Shapes::Sphere<float>(10, MathTypes::Vector<3, float>(0, -10, -10)))
+			));
+		objectsInScene.push_back(std::shared_ptr<RayTracing::I_IntersectableShape>(
+			new RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<Shapes::Quadrilateral<3, float>>>(
+				GLUtility::Colour<float>(0.5, 0.5, 0.5), true, Shapes::Quadrilateral<3, float>(
+				MathTypes::Vector<3, float>(-80, -30, -20),
+				MathTypes::Vector<3, float>(0, -30, -20),
+				MathTypes::Vector<3, float>(-80, 100, -20),
+				MathTypes::Vector<3, float>(0, 100, -20)))
+			));
+		objectsInScene.push_back(std::shared_ptr<RayTracing::I_IntersectableShape>(
+			new RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<Shapes::Quadrilateral<3, float>>>(
+				GLUtility::Colour<float>(0.9, 0.9, 0.5), true, Shapes::Quadrilateral<3, float>(
+				MathTypes::Vector<3, float>(0, -30, -20),
+				MathTypes::Vector<3, float>(80, -30, -20),
+				MathTypes::Vector<3, float>(0, 100, -20),
+				MathTypes::Vector<3, float>(80, 100, -20)))
+			));
+		
+		return objectsInScene;		
+	}
+
+	//A ball of a quarter million small spheres floating over the floor
+	std::list<std::shared_ptr<RayTracing::I_IntersectableShape>> sphereCloudScene()
+	{
+		const int numberOfSpheres = 250000;
+		const float radiusOfBall = 25;
+		const MathTypes::Vector<3, float> centreOfBall(0, 0, -15);
+
+		std::mt19937 generator(453);
+		std::uniform_real_distribution<float> coordinate(-radiusOfBall, radiusOfBall);
+		Shapes::SphereCloud<float> particles(0.3);
+		particles.reserve(numberOfSpheres);
+		while(particles.numberOfSpheres() < numberOfSpheres)
+		{
+			MathTypes::Vector<3, float> offset(coordinate(generator), coordinate(generator), coordinate(generator));
+			if(offset.magnitude() <= radiusOfBall)
+			{
+				particles.addSphere(centreOfBall + offset);
+			}
+		}
+
+		auto particleCloud = new RayTracing::IntersectableShape<Shapes::SphereCloud<float>>(
+			GLUtility::Colour<float>(0.9, 0.6, 0.2), false, particles);
+
+		auto floor = new RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<Shapes::Quadrilateral<3, float>>>(
+			GLUtility::Colour<float>(0.1, .5, .5), false, Shapes::Quadrilateral<3, float>(
+			MathTypes::Vector<3, float>(-80, -30, 40),
+			MathTypes::Vector<3, float>(80, -30, 40),
+			MathTypes::Vector<3, float>(-80, -30, -80),
+			MathTypes::Vector<3, float>(80, -30, -80)));
+
+		return std::list<std::shared_ptr<RayTracing::I_IntersectableShape>>({
+			std::shared_ptr<RayTracing::I_IntersectableShape>(particleCloud), 
+			std::shared_ptr<RayTracing::I_IntersectableShape>(floor)
+		});
+	}
+
+	//A level 5 Menger sponge, which would take 3.2 million cubes to build, standing on the floor. It starts just
+	//behind the image plane, since rays starting inside it would have no surface to shade.
+	std::list<std::shared_ptr<RayTracing::I_IntersectableShape>> mengerSpongeScene()
+	{
+		auto sponge = new RayTracing::IntersectableShape<Shapes::MengerSponge<float>>(
+			GLUtility::Colour<float>(0.9, 0.6, 0.2), false,
+			Shapes::MengerSponge<float>(MathTypes::Vector<3, float>(-20, -30, -5), 40, 5));
+
+		auto floor = new RayTracing::IntersectableShape<RayTracing::TriangleBasedShape<Shapes::Quadrilateral<3, float>>>(
+			GLUtility::Colour<float>(0.1, .5, .5), false, Shapes::Quadrilateral<3, float>(
+			MathTypes::Vector<3, float>(-80, -30, 40),
+			MathTypes::Vector<3, float>(80, -30, 40),
+			MathTypes::Vector<3, float>(-80, -30, -80),
+			MathTypes::Vector<3, float>(80, -30, -80)));
+
+		return std::list<std::shared_ptr<RayTracing::I_IntersectableShape>>({
+			std::shared_ptr<RayTracing::I_IntersectableShape>(sponge), 
+			std::shared_ptr<RayTracing::I_IntersectableShape>(floor)
+		});
+	}
+
+	//Lights of limited reach scattered through the space above the floor that every scene shares. The more
+	//lights there are, the dimmer each one is, so that a point receives about the same light either way.
+	std::vector<RayTracing::PointLight> scatteredLights(int numberOfLights)
+	{
+		const float radiusOfLights = 30;
+		const float intensityOfLights = std::min(1.0f, 10.0f / numberOfLights);
+
+		std::mt19937 generator(453);
+		std::uniform_real_distribution<float> x(-40, 40);
+		std::uniform_real_distribution<float> y(-25, 30);
+		std::uniform_real_distribution<float> z(-40, 30);
+		std::vector<RayTracing::PointLight> lights;
+		for(int i = 0; i < numberOfLights; i++)
+		{
+			lights.push_back(RayTracing::PointLight(
+				MathTypes::Vector<3, float>(x(generator), y(generator), z(generator)), intensityOfLights, radiusOfLights));
+		}
+		return lights;
+	}
 }
\ No newline at end of file
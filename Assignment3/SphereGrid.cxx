@@ -0,0 +1,351 @@
+#include "assignmentSpecific/SphereGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "math/Matrix.h"
+#include "math/Vector.h"
+
+namespace
+{
+	//Smallest cell size, in sphere diameters. Smaller cells list each sphere in more cells.
+	const float MINIMUM_CELL_SIZE_IN_DIAMETERS = 2;
+
+	//Keeps rays leaving the surface of a sphere from hitting that same sphere again
+	const float MINIMUM_INTERSECTION_DISTANCE = 1e-4;
+
+	float componentAlongAxis(const MathTypes::Vector<3, float>& vector, int axis)
+	{
+		switch(axis)
+		{
+			case(0):
+				return vector.xValue();
+			case(1):
+				return vector.yValue();
+			default:
+				return vector.zValue();
+		}
+	}
+}
+
+RayTracing::SphereGrid::SphereGrid(const Shapes::SphereCloud<float>& spheres)
+	: spheres_(spheres)
+	, bounds_(BoundingBox::emptyBox())
+	, cellSize_(1)
+	, numberOfCells_{1, 1, 1}
+{
+	build();
+}
+
+const Shapes::SphereCloud<float>& RayTracing::SphereGrid::spheres() const
+{
+	return spheres_;
+}
+
+RayTracing::BoundingBox RayTracing::SphereGrid::boundingBox() const
+{
+	return bounds_;
+}
+
+void RayTracing::SphereGrid::transform(const MathTypes::Matrix<4, 4, float>& transformationMatrix)
+{
+	spheres_.transform(transformationMatrix);
+	build();
+}
+
+void RayTracing::SphereGrid::build()
+{
+	const int numberOfSpheres = spheres_.numberOfSpheres();
+	const float radius = spheres_.radius();
+
+	bounds_ = BoundingBox::emptyBox();
+	for(int i = 0; i < numberOfSpheres; i++)
+	{
+		bounds_ = bounds_.enclosing(spheres_.centre(i));
+	}
+	if(numberOfSpheres == 0)
+	{
+		numberOfCells_[0] = numberOfCells_[1] = numberOfCells_[2] = 1;
+		firstReferenceOfCell_.assign(2, 0);
+		sphereReferences_.clear();
+		return;
+	}
+	bounds_ = bounds_.expandedBy(radius);
+
+	//Aim for about one cell per sphere, but never let cells get so small that spheres span many of them
+	auto extent = bounds_.maximumCorner() - bounds_.minimumCorner();
+	const float volume = extent.xValue() * extent.yValue() * extent.zValue();
+	cellSize_ = std::max(std::cbrt(volume / numberOfSpheres), MINIMUM_CELL_SIZE_IN_DIAMETERS * 2 * radius);
+	if(!(cellSize_ > 0))
+	{
+		cellSize_ = 1;
+	}
+	for(int axis = 0; axis < 3; axis++)
+	{
+		numberOfCells_[axis] = std::max(1, static_cast<int>(std::ceil(componentAlongAxis(extent, axis) / cellSize_)));
+	}
+	const int totalNumberOfCells = numberOfCells_[0] * numberOfCells_[1] * numberOfCells_[2];
+
+	//Store spheres in the order of the cells their centres lie in, so that the spheres of a cell are tested
+	//from neighbouring memory
+	const auto& x = spheres_.xCoordinates();
+	const auto& y = spheres_.yCoordinates();
+	const auto& z = spheres_.zCoordinates();
+	std::vector<int> firstSphereOfCell(totalNumberOfCells + 1, 0);
+	std::vector<int> cellOfSphere(numberOfSpheres);
+	for(int i = 0; i < numberOfSpheres; i++)
+	{
+		cellOfSphere[i] = indexOfCell(cellAlongAxis(x[i], 0), cellAlongAxis(y[i], 1), cellAlongAxis(z[i], 2));
+		firstSphereOfCell[cellOfSphere[i] + 1]++;
+	}
+	std::partial_sum(std::begin(firstSphereOfCell), std::end(firstSphereOfCell), std::begin(firstSphereOfCell));
+	std::vector<int> newOrder(numberOfSpheres);
+	for(int i = 0; i < numberOfSpheres; i++)
+	{
+		newOrder[i] = firstSphereOfCell[cellOfSphere[i]]++;
+	}
+	spheres_.reorder(newOrder);
+
+	//List each sphere in every cell that its bounds overlap. Counted first so the lists can be packed together.
+	auto forEachCellOverlappedBySphere = [&](int sphereIndex, auto action)
+	{
+		const float centre[3] = {x[sphereIndex], y[sphereIndex], z[sphereIndex]};
+		int lowestCell[3];
+		int highestCell[3];
+		for(int axis = 0; axis < 3; axis++)
+		{
+			lowestCell[axis] = cellAlongAxis(centre[axis] - radius, axis);
+			highestCell[axis] = cellAlongAxis(centre[axis] + radius, axis);
+		}
+		for(int cellZ = lowestCell[2]; cellZ <= highestCell[2]; cellZ++)
+		{
+			for(int cellY = lowestCell[1]; cellY <= highestCell[1]; cellY++)
+			{
+				for(int cellX = lowestCell[0]; cellX <= highestCell[0]; cellX++)
+				{
+					action(indexOfCell(cellX, cellY, cellZ));
+				}
+			}
+		}
+	};
+
+	firstReferenceOfCell_.assign(totalNumberOfCells + 1, 0);
+	for(int i = 0; i < numberOfSpheres; i++)
+	{
+		forEachCellOverlappedBySphere(i, [&](int cellIndex)
+			{
+				firstReferenceOfCell_[cellIndex + 1]++;
+			});
+	}
+	std::partial_sum(std::begin(firstReferenceOfCell_), std::end(firstReferenceOfCell_), std::begin(firstReferenceOfCell_));
+
+	sphereReferences_.resize(firstReferenceOfCell_.back());
+	std::vector<int> nextReferenceOfCell(std::begin(firstReferenceOfCell_), std::end(firstReferenceOfCell_) - 1);
+	for(int i = 0; i < numberOfSpheres; i++)
+	{
+		forEachCellOverlappedBySphere(i, [&](int cellIndex)
+			{
+				sphereReferences_[nextReferenceOfCell[cellIndex]++] = i;
+			});
+	}
+}
+
+int RayTracing::SphereGrid::cellAlongAxis(float coordinate, int axis) const
+{
+	const float distanceIntoGrid = coordinate - componentAlongAxis(bounds_.minimumCorner(), axis);
+	const int cell = static_cast<int>(std::floor(distanceIntoGrid / cellSize_));
+	return std::clamp(cell, 0, numberOfCells_[axis] - 1);
+}
+
+int RayTracing::SphereGrid::indexOfCell(int x, int y, int z) const
+{
+	return (z * numberOfCells_[1] + y) * numberOfCells_[0] + x;
+}
+
+std::optional<float> RayTracing::SphereGrid::intersectionWithSphere(
+	int sphereIndex,
+	const MathTypes::Vector<3, float>& origin,
+	const MathTypes::Vector<3, float>& direction) const
+{
+	//Rays have unit length directions, which drops the quadratic term
+	const float centreToOriginX = origin.xValue() - spheres_.xCoordinates()[sphereIndex];
+	const float centreToOriginY = origin.yValue() - spheres_.yCoordinates()[sphereIndex];
+	const float centreToOriginZ = origin.zValue() - spheres_.zCoordinates()[sphereIndex];
+	const float b = centreToOriginX * direction.xValue() + centreToOriginY * direction.yValue() + centreToOriginZ * direction.zValue();
+	const float c = centreToOriginX * centreToOriginX + centreToOriginY * centreToOriginY + centreToOriginZ * centreToOriginZ
+		- spheres_.radius() * spheres_.radius();
+	const float discriminant = b * b - c;
+	if(discriminant < 0)
+	{
+		return std::nullopt;
+	}
+
+	const float squareRootOfDiscriminant = std::sqrt(discriminant);
+	if(-b - squareRootOfDiscriminant > MINIMUM_INTERSECTION_DISTANCE)
+	{
+		return -b - squareRootOfDiscriminant;
+	}
+	else if(-b + squareRootOfDiscriminant > MINIMUM_INTERSECTION_DISTANCE)
+	{
+		return -b + squareRootOfDiscriminant;
+	}
+	else
+	{
+		return std::nullopt;
+	}
+}
+
+template<typename CellVisitor>
+void RayTracing::SphereGrid::traverse(const Ray& ray, CellVisitor visitCell) const
+{
+	const auto origin = ray.origin();
+	const auto direction = ray.direction();
+	const MathTypes::Vector<3, float> inverseDirection(1 / direction.xValue(), 1 / direction.yValue(), 1 / direction.zValue());
+	const float infinity = std::numeric_limits<float>::infinity();
+
+	auto distanceToGrid = bounds_.entryDistance(ray, inverseDirection, infinity);
+	if(!distanceToGrid)
+	{
+		return;
+	}
+	const auto pointOfEntry = ray.pointAlongLine(*distanceToGrid);
+
+	int cell[3];
+	int step[3];
+	float distanceToNextCrossing[3];
+	float distanceBetweenCrossings[3];
+	for(int axis = 0; axis < 3; axis++)
+	{
+		const float originComponent = componentAlongAxis(origin, axis);
+		const float directionComponent = componentAlongAxis(direction, axis);
+		const float inverseDirectionComponent = componentAlongAxis(inverseDirection, axis);
+		const float gridMinimum = componentAlongAxis(bounds_.minimumCorner(), axis);
+
+		cell[axis] = cellAlongAxis(componentAlongAxis(pointOfEntry, axis), axis);
+		if(directionComponent > 0)
+		{
+			step[axis] = 1;
+			distanceToNextCrossing[axis] = (gridMinimum + (cell[axis] + 1) * cellSize_ - originComponent) * inverseDirectionComponent;
+			distanceBetweenCrossings[axis] = cellSize_ * inverseDirectionComponent;
+		}
+		else if(directionComponent < 0)
+		{
+			step[axis] = -1;
+			distanceToNextCrossing[axis] = (gridMinimum + cell[axis] * cellSize_ - originComponent) * inverseDirectionComponent;
+			distanceBetweenCrossings[axis] = -cellSize_ * inverseDirectionComponent;
+		}
+		else
+		{
+			step[axis] = 0;
+			distanceToNextCrossing[axis] = infinity;
+			distanceBetweenCrossings[axis] = infinity;
+		}
+	}
+
+	while(true)
+	{
+		int axisOfNextCrossing = 0;
+		if(distanceToNextCrossing[1] < distanceToNextCrossing[axisOfNextCrossing])
+		{
+			axisOfNextCrossing = 1;
+		}
+		if(distanceToNextCrossing[2] < distanceToNextCrossing[axisOfNextCrossing])
+		{
+			axisOfNextCrossing = 2;
+		}
+
+		if(visitCell(indexOfCell(cell[0], cell[1], cell[2]), distanceToNextCrossing[axisOfNextCrossing]))
+		{
+			return;
+		}
+
+		cell[axisOfNextCrossing] += step[axisOfNextCrossing];
+		if(cell[axisOfNextCrossing] < 0 || cell[axisOfNextCrossing] >= numberOfCells_[axisOfNextCrossing])
+		{
+			return;
+		}
+		distanceToNextCrossing[axisOfNextCrossing] += distanceBetweenCrossings[axisOfNextCrossing];
+	}
+}
+
+std::optional<float> RayTracing::SphereGrid::closestIntersection(const Ray& ray, int* sphereIndex) const
+{
+	const auto origin = ray.origin();
+	const auto direction = ray.direction();
+	float closestDistance = std::numeric_limits<float>::infinity();
+	int closestSphere = -1;
+
+	traverse(ray, [&](int cellIndex, float distanceAtWhichRayLeavesCell)
+		{
+			for(int i = firstReferenceOfCell_[cellIndex]; i < firstReferenceOfCell_[cellIndex + 1]; i++)
+			{
+				auto distance = intersectionWithSphere(sphereReferences_[i], origin, direction);
+				if(distance && *distance < closestDistance)
+				{
+					closestDistance = *distance;
+					closestSphere = sphereReferences_[i];
+				}
+			}
+			//Spheres overlap several cells, so a hit found here may lie in a later cell, where a closer sphere
+			//could still be waiting
+			return closestDistance <= distanceAtWhichRayLeavesCell;
+		});
+
+	if(closestSphere >= 0)
+	{
+		*sphereIndex = closestSphere;
+		return closestDistance;
+	}
+	else
+	{
+		return std::nullopt;
+	}
+}
+
+bool RayTracing::SphereGrid::rayIntersectsASphere(const Ray& ray) const
+{
+	const auto origin = ray.origin();
+	const auto direction = ray.direction();
+	bool intersectionFound = false;
+
+	traverse(ray, [&](int cellIndex, float)
+		{
+			for(int i = firstReferenceOfCell_[cellIndex]; i < firstReferenceOfCell_[cellIndex + 1]; i++)
+			{
+				if(intersectionWithSphere(sphereReferences_[i], origin, direction))
+				{
+					intersectionFound = true;
+					break;
+				}
+			}
+			return intersectionFound;
+		});
+
+	return intersectionFound;
+}
+
+std::optional<int> RayTracing::SphereGrid::sphereNearestToSurfacePoint(const MathTypes::Vector<3, float>& point) const
+{
+	if(sphereReferences_.empty())
+	{
+		return std::nullopt;
+	}
+
+	const int cellIndex = indexOfCell(
+		cellAlongAxis(point.xValue(), 0), cellAlongAxis(point.yValue(), 1), cellAlongAxis(point.zValue(), 2));
+	std::optional<int> nearestSphere;
+	float nearestDistanceFromSurface = std::numeric_limits<float>::infinity();
+	for(int i = firstReferenceOfCell_[cellIndex]; i < firstReferenceOfCell_[cellIndex + 1]; i++)
+	{
+		const float distanceFromSurface = std::abs(
+			(point - spheres_.centre(sphereReferences_[i])).magnitude() - spheres_.radius());
+		if(distanceFromSurface < nearestDistanceFromSurface)
+		{
+			nearestDistanceFromSurface = distanceFromSurface;
+			nearestSphere = sphereReferences_[i];
+		}
+	}
+	return nearestSphere;
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "assignmentSpecific/BoundingBox.h"
+#include "assignmentSpecific/Ray.h"
+#include "shapes/SphereCloud.h"
+
+namespace MathTypes
+{
+	template<int rows, int columns, typename CoordinatePrimitive> class Matrix;
+	template<int dimensions, typename CoordinatePrimitive> class Vector;
+}
+
+namespace RayTracing
+{
+	//Uniform grid over a cloud of equal radius spheres. Each cell lists the spheres whose bounds overlap it, and
+	//rays walk the cells they pass through in order (3D-DDA, Amanatides and Woo), so only the spheres near a ray
+	//are ever tested. Cells are at least two spheres across, so a sphere is listed in fewer than four cells on
+	//average, and there is about one cell per sphere. Together with the centres that is roughly 30 bytes per
+	//sphere, rather than the hundreds taken by a separately allocated shape for each sphere.
+	class SphereGrid
+	{
+	public:
+		SphereGrid(const Shapes::SphereCloud<float>& spheres);
+		~SphereGrid() = default;
+
+		const Shapes::SphereCloud<float>& spheres() const;
+		BoundingBox boundingBox() const;
+
+		//Moves every sphere and rebuilds the grid around their new positions
+		void transform(const MathTypes::Matrix<4, 4, float>& transformationMatrix);
+
+		//Distance along the ray to the closest sphere it hits. The index of that sphere is written to sphereIndex.
+		std::optional<float> closestIntersection(const Ray& ray, int* sphereIndex) const;
+		bool rayIntersectsASphere(const Ray& ray) const;
+		//The sphere whose surface lies closest to a point, searching only the cell that the point lies in
+		std::optional<int> sphereNearestToSurfacePoint(const MathTypes::Vector<3, float>& point) const;
+
+	private:
+		void build();
+		int cellAlongAxis(float coordinate, int axis) const;
+		int indexOfCell(int x, int y, int z) const;
+		std::optional<float> intersectionWithSphere(
+			int sphereIndex,
+			const MathTypes::Vector<3, float>& origin,
+			const MathTypes::Vector<3, float>& direction) const;
+
+		//Walks the cells along the ray, nearest first, calling visitCell(cellIndex, distanceAtWhichRayLeavesCell)
+		//until it returns true or the ray leaves the grid
+		template<typename CellVisitor>
+		void traverse(const Ray& ray, CellVisitor visitCell) const;
+
+	private:
+		Shapes::SphereCloud<float> spheres_;
+		BoundingBox bounds_;
+		float cellSize_;
+		int numberOfCells_[3];
+		//The spheres overlapping cell i are sphereReferences_[firstReferenceOfCell_[i]] up to, but not including,
+		//sphereReferences_[firstReferenceOfCell_[i + 1]]
+		std::vector<int> firstReferenceOfCell_;
+		std::vector<int> sphereReferences_;
+	};
+}
\ No newline at end of file
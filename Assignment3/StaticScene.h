@@ -0,0 +1,209 @@
+#pragma once
+
+#include <limits>
+#include <list>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "assignmentSpecific/BoundingBox.h"
+#include "assignmentSpecific/I_SceneGeometry.h"
+#include "assignmentSpecific/IntersectableShape.h"
+#include "assignmentSpecific/Ray.h"
+#include "math/Vector.h"
+
+namespace RayTracing
+{
+	namespace StaticSceneDetail
+	{
+		//Keeps rays that graze flat objects like quadrilaterals from being culled by floating point error
+		const float BOUNDS_PADDING = 1e-3;
+
+		inline MathTypes::Vector<3, float> inverseOfDirection(const Ray& ray)
+		{
+			auto direction = ray.direction();
+			return MathTypes::Vector<3, float>(1 / direction.xValue(), 1 / direction.yValue(), 1 / direction.zValue());
+		}
+	}
+
+	//Scene geometry for scenes made of a fixed set of shape types, e.g. StaticScene<Shapes::Sphere<float>,
+	//TriangleBasedShape<Shapes::Quadrilateral<3, float>>>. Objects are kept in one array per type, along with their
+	//bounding boxes, and every ray is tested against all of them. The compiler generates a loop for each type that
+	//calls the final IntersectableShape specialisation directly, with no virtual calls and no lists of
+	//intersection points. Meant for scenes of a handful of objects; large scenes are better served by a
+	//BoundingVolumeHierarchy.
+	//Like IntersectableShape.h, this may only be included from one translation unit.
+	template<typename... UnderlyingShapes>
+	class StaticScene : public I_SceneGeometry
+	{
+	public:
+		//Returns NULL if an object has a shape other than UnderlyingShapes, in which case the scene has to be
+		//handled by the general, virtual path
+		static std::shared_ptr<StaticScene> fromObjects(const std::list<std::shared_ptr<I_IntersectableShape>>& objects);
+		~StaticScene() = default;
+
+		std::optional<MathTypes::Vector<3, float>> closestIntersectionPoint(
+			I_IntersectableShape** closestIntersectedShape,
+			const Ray& ray) const override;
+		bool rayIntersectsAnObject(const Ray& ray, float maximumDistance) const override;
+		//Recalculates the bounding boxes of the objects
+		void update() override;
+
+	private:
+		template<typename UnderlyingShape>
+		struct BoundedObject
+		{
+			IntersectableShape<UnderlyingShape>* object;
+			BoundingBox bounds;
+		};
+
+		template<typename UnderlyingShape>
+		using ObjectsOfShape = std::vector<BoundedObject<UnderlyingShape>>;
+
+		StaticScene(const std::list<std::shared_ptr<I_IntersectableShape>>& objects);
+
+		template<typename UnderlyingShape>
+		bool addObjectIfOfShape(I_IntersectableShape* object);
+		template<typename UnderlyingShape>
+		void updateBoundsOfShape();
+		template<typename UnderlyingShape>
+		void findCloserIntersection(
+			const Ray& ray,
+			const MathTypes::Vector<3, float>& inverseDirection,
+			float* closestDistance,
+			I_IntersectableShape** closestObject) const;
+		template<typename UnderlyingShape>
+		bool rayIntersectsAnObjectOfShape(
+			const Ray& ray,
+			const MathTypes::Vector<3, float>& inverseDirection,
+			float maximumDistance) const;
+
+	private:
+		//Keeps the objects alive
+		std::list<std::shared_ptr<I_IntersectableShape>> objects_;
+		std::tuple<ObjectsOfShape<UnderlyingShapes>...> objectsOfEachShape_;
+	};
+}
+
+template<typename... UnderlyingShapes>
+std::shared_ptr<RayTracing::StaticScene<UnderlyingShapes...>> RayTracing::StaticScene<UnderlyingShapes...>::fromObjects(
+	const std::list<std::shared_ptr<I_IntersectableShape>>& objects)
+{
+	std::shared_ptr<StaticScene> scene(new StaticScene(objects));
+	for(const auto& object : objects)
+	{
+		//Stops at the first shape that matches
+		if(!(scene->template addObjectIfOfShape<UnderlyingShapes>(object.get()) || ...))
+		{
+			return NULL;
+		}
+	}
+	return scene;
+}
+
+template<typename... UnderlyingShapes>
+RayTracing::StaticScene<UnderlyingShapes...>::StaticScene(const std::list<std::shared_ptr<I_IntersectableShape>>& objects)
+	: objects_(objects)
+{
+}
+
+template<typename... UnderlyingShapes>
+std::optional<MathTypes::Vector<3, float>> RayTracing::StaticScene<UnderlyingShapes...>::closestIntersectionPoint(
+	I_IntersectableShape** closestIntersectedShape,
+	const Ray& ray) const
+{
+	const auto inverseDirection = StaticSceneDetail::inverseOfDirection(ray);
+	float closestDistance = std::numeric_limits<float>::infinity();
+	I_IntersectableShape* closestObject = NULL;
+	(findCloserIntersection<UnderlyingShapes>(ray, inverseDirection, &closestDistance, &closestObject), ...);
+
+	if(closestObject == NULL)
+	{
+		return std::nullopt;
+	}
+	*closestIntersectedShape = closestObject;
+	return ray.pointAlongLine(closestDistance);
+}
+
+template<typename... UnderlyingShapes>
+bool RayTracing::StaticScene<UnderlyingShapes...>::rayIntersectsAnObject(const Ray& ray, float maximumDistance) const
+{
+	const auto inverseDirection = StaticSceneDetail::inverseOfDirection(ray);
+	return (rayIntersectsAnObjectOfShape<UnderlyingShapes>(ray, inverseDirection, maximumDistance) || ...);
+}
+
+template<typename... UnderlyingShapes>
+void RayTracing::StaticScene<UnderlyingShapes...>::update()
+{
+	(updateBoundsOfShape<UnderlyingShapes>(), ...);
+}
+
+template<typename... UnderlyingShapes>
+template<typename UnderlyingShape>
+bool RayTracing::StaticScene<UnderlyingShapes...>::addObjectIfOfShape(I_IntersectableShape* object)
+{
+	auto objectOfShape = dynamic_cast<IntersectableShape<UnderlyingShape>*>(object);
+	if(objectOfShape == NULL)
+	{
+		return false;
+	}
+	std::get<ObjectsOfShape<UnderlyingShape>>(objectsOfEachShape_).push_back(
+		BoundedObject<UnderlyingShape>{objectOfShape, objectOfShape->boundingBox().expandedBy(StaticSceneDetail::BOUNDS_PADDING)});
+	return true;
+}
+
+template<typename... UnderlyingShapes>
+template<typename UnderlyingShape>
+void RayTracing::StaticScene<UnderlyingShapes...>::updateBoundsOfShape()
+{
+	for(auto& boundedObject : std::get<ObjectsOfShape<UnderlyingShape>>(objectsOfEachShape_))
+	{
+		boundedObject.bounds = boundedObject.object->boundingBox().expandedBy(StaticSceneDetail::BOUNDS_PADDING);
+	}
+}
+
+template<typename... UnderlyingShapes>
+template<typename UnderlyingShape>
+void RayTracing::StaticScene<UnderlyingShapes...>::findCloserIntersection(
+	const Ray& ray,
+	const MathTypes::Vector<3, float>& inverseDirection,
+	float* closestDistance,
+	I_IntersectableShape** closestObject) const
+{
+	for(const auto& boundedObject : std::get<ObjectsOfShape<UnderlyingShape>>(objectsOfEachShape_))
+	{
+		if(!boundedObject.bounds.entryDistance(ray, inverseDirection, *closestDistance))
+		{
+			continue;
+		}
+		auto distance = boundedObject.object->closestIntersectionDistance(ray);
+		if(distance && *distance < *closestDistance)
+		{
+			*closestDistance = *distance;
+			*closestObject = boundedObject.object;
+		}
+	}
+}
+
+template<typename... UnderlyingShapes>
+template<typename UnderlyingShape>
+bool RayTracing::StaticScene<UnderlyingShapes...>::rayIntersectsAnObjectOfShape(
+	const Ray& ray,
+	const MathTypes::Vector<3, float>& inverseDirection,
+	float maximumDistance) const
+{
+	for(const auto& boundedObject : std::get<ObjectsOfShape<UnderlyingShape>>(objectsOfEachShape_))
+	{
+		if(!boundedObject.bounds.entryDistance(ray, inverseDirection, maximumDistance))
+		{
+			continue;
+		}
+		auto distance = boundedObject.object->closestIntersectionDistance(ray);
+		if(distance && *distance < maximumDistance)
+		{
+			return true;
+		}
+	}
+	return false;
+}
\ No newline at end of file
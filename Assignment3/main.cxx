@@ -1,109 +1,356 @@
-#include <cstring>
-#include <list>
-#include <iostream>
-#include <string>
-
-#include "assignmentSpecific/TutorialLibraries/image.h"
-#include "assignmentSpecific/TutorialLibraries/ImagePlane.h"
-
-#include "assignmentSpecific/RayTracer.h"
-#include "assignmentSpecific/Scenes.h"
-#include "math/Vector.h"
-
-namespace
-{
-	void parseCommandLineArguments(int ac, char** av, int* width, int* height, std::string* fileName, 
-		std::list<std::shared_ptr<RayTracing::I_IntersectableShape>>* scene);
-
-	const MathTypes::Vector<3, float> eyePosition(0, 10, 25);
-	const MathTypes::Vector<3, float> lookingDirection(0, -0.4, -1);
-	const MathTypes::Vector<3, float> up(0, 1, 0);
-	const MathTypes::Vector<3, float> lightPosition(25, 25, 10);
-	const float eyeToImagePlane = 25;
-	const float planeWidth = 50;
-	const float planeHeight = 50;
-}
-
-int main(int ac, char** av)
-{
-	int resolutionWidth, resolutionHeight;
-	std::string fileName;
-	std::list<std::shared_ptr<RayTracing::I_IntersectableShape>> scene;
-	parseCommandLineArguments(ac, av, &resolutionWidth, &resolutionHeight, &fileName, &scene);
-
-	auto imagePlane = RayTracing::makeImagePlane(
-		eyePosition, lookingDirection, up, resolutionWidth, resolutionHeight, planeWidth, planeHeight, eyeToImagePlane);
-	RayTracing::RayTracer tracer(scene);
-	raster::write_screen_to_file(fileName.c_str(), tracer.renderSceneGivenParameters(eyePosition, lightPosition, imagePlane));
-}
-
-namespace
-{
-	void parseCommandLineArguments(int ac, char** av, int* width, int* height, std::string* fileName, 
-		std::list<std::shared_ptr<RayTracing::I_IntersectableShape>>* scene)
-	{
-		if(ac != 4)
-		{
-			std::cerr << "Error in arguments. Wrong number of arguments." << std::endl;
-			std::cerr << 
-			R"(
-			Usage: ./AssignmentThree_EvanHampton resolution scene_complexity output_file_name
-				
-				-resolution: "INTxINT"
-				-scene_complexity: "low", "medium", or "high"
-				-output_file_name: "AnythingYourHeartDesires.png"
-			)"<< std::endl;
-
-			exit(-1);
-		}
-		else
-		{
-			std::string resolution(av[1]);
-			*width = std::stoi(resolution.substr(0, resolution.find("x")));
-			*height = std::stoi(resolution.substr(resolution.find("x") + 1, resolution.length()));
-			if(*width <= 0 || *height <= 0)
-			{
-			std::cerr << "Error in arguments. Resolution must be greater than zero." << std::endl;
-			std::cerr << 
-			R"(
-			Usage: ./AssignmentThree_EvanHampton resolution scene_complexity output_file_name
-				
-				-resolution: "INTxINT"
-				-scene_complexity: "low", "medium", or "high"
-				-output_file_name: "AnythingYourHeartDesires.png"
-			)"<< std::endl;
-
-			exit(-1);
-			}
-
-			*fileName = av[3];
-
-			if(strcmp(av[2], "low") == 0)
-			{
-				*scene = Scenes::simpleScene();
-			}
-			else if(strcmp(av[2], "medium") == 0)
-			{
-				*scene = Scenes::mediumComplexityScene();
-			}
-			else if(strcmp(av[2], "high") == 0)
-			{
-				*scene = Scenes::complexScene();
-			}
-			else
-			{
-			std::cerr << "Error in arguments. Unrecognized scene complexity." << std::endl;
-			std::cerr << 
-			R"(
-			Usage: ./AssignmentThree_EvanHampton resolution scene_complexity output_file_name
-				
-				-resolution: "INTxINT"
-				-scene_complexity: "low", "medium", or "high"
-				-output_file_name: "AnythingYourHeartDesires.png"
-			)"<< std::endl;
-
-			exit(-1);
-			}
-		}
-	}
-}
+#include <chrono>
+#include <cstring>
+#include <list>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "assignmentSpecific/TutorialLibraries/image.h"
+#include "assignmentSpecific/TutorialLibraries/ImagePlane.h"
+
+#include "assignmentSpecific/Denoiser.h"
+#include "assignmentSpecific/ImageFiles.h"
+#include "assignmentSpecific/RayTracer.h"
+#include "assignmentSpecific/RegressionSuite.h"
+#include "assignmentSpecific/Scenes.h"
+#include "assignmentSpecific/StaticScene.h"
+#include "math/Vector.h"
+#include "profiling/Profiler.h"
+
+namespace
+{
+	struct RenderOptions
+	{
+		bool checkerboard = false;
+		bool denoise = false;
+		bool specialised = false;
+		//0 for the single light of the original assignment
+		int numberOfLights = 0;
+		int maximumLightSamplesPerPoint = RayTracing::RayTracer::DEFAULT_MAXIMUM_LIGHT_SAMPLES_PER_POINT;
+		//The whole image if not set
+		std::optional<RayTracing::RayTracer::PixelRectangle> crop;
+		//Pastes the crop into this image, rather than writing the crop on its own
+		std::string pasteIntoFileName;
+	};
+
+	//Every scene but the sphere cloud is made of only these shapes
+	using SpecialisedScene = RayTracing::StaticScene<
+		Shapes::Sphere<float>, RayTracing::TriangleBasedShape<Shapes::Quadrilateral<3, float>>>;
+
+	void parseCommandLineArguments(int ac, char** av, int* width, int* height, std::string* fileName, 
+		std::list<std::shared_ptr<RayTracing::I_IntersectableShape>>* scene, RenderOptions* options);
+	std::shared_ptr<RayTracing::RayTracer> makeRayTracer(
+		const std::list<std::shared_ptr<RayTracing::I_IntersectableShape>>& scene, bool specialised);
+	void runRegressionSuite(int ac, char** av);
+	bool sceneNamed(const std::string& name, std::list<std::shared_ptr<RayTracing::I_IntersectableShape>>* scene);
+	bool parsePixelRectangle(const std::string& text, RayTracing::RayTracer::PixelRectangle* rectangle);
+	void pasteImage(const geometry::Grid2<raster::RGB>& image, int x, int y, geometry::Grid2<raster::RGB>* destination);
+	void exitWithUsage(const std::string& error);
+
+	const MathTypes::Vector<3, float> eyePosition(0, 10, 25);
+	const MathTypes::Vector<3, float> lookingDirection(0, -0.4, -1);
+	const MathTypes::Vector<3, float> up(0, 1, 0);
+	const MathTypes::Vector<3, float> lightPosition(25, 25, 10);
+	const float eyeToImagePlane = 25;
+	const float planeWidth = 50;
+	const float planeHeight = 50;
+
+	const std::vector<std::string> SCENE_NAMES = {"low", "medium", "high", "cloud", "sponge"};
+}
+
+int main(int ac, char** av)
+{
+	if(ac > 1 && strcmp(av[1], "--regression") == 0)
+	{
+		runRegressionSuite(ac, av);
+	}
+
+	int resolutionWidth, resolutionHeight;
+	std::string fileName;
+	std::list<std::shared_ptr<RayTracing::I_IntersectableShape>> scene;
+	RenderOptions options;
+	parseCommandLineArguments(ac, av, &resolutionWidth, &resolutionHeight, &fileName, &scene, &options);
+
+	auto imagePlane = RayTracing::makeImagePlane(
+		eyePosition, lookingDirection, up, resolutionWidth, resolutionHeight, planeWidth, planeHeight, eyeToImagePlane);
+	auto tracer = makeRayTracer(scene, options.specialised);
+	if(options.checkerboard)
+	{
+		tracer->enableCheckerboardRendering();
+	}
+	tracer->setMaximumLightSamplesPerPoint(options.maximumLightSamplesPerPoint);
+	const auto lights = options.numberOfLights > 0
+		? Scenes::scatteredLights(options.numberOfLights)
+		: std::vector<RayTracing::PointLight>{RayTracing::PointLight(lightPosition)};
+
+	const auto region = options.crop ? *options.crop
+		: RayTracing::RayTracer::PixelRectangle{0, 0, resolutionWidth, resolutionHeight};
+	if(!options.pasteIntoFileName.empty())
+	{
+		if(!ImageFiles::readPortablePixmap(options.pasteIntoFileName, &imagePlane.screen)
+			|| imagePlane.screen.width() != resolutionWidth || imagePlane.screen.height() != resolutionHeight)
+		{
+			std::cerr << "Failed to read " << options.pasteIntoFileName << " as a " << resolutionWidth << "x"
+				<< resolutionHeight << " pixmap" << std::endl;
+			exit(-1);
+		}
+	}
+
+	auto renderStart = std::chrono::steady_clock::now();
+	auto image = tracer->renderRegionGivenParameters(eyePosition, lights, imagePlane, region);
+	auto denoiseStart = std::chrono::steady_clock::now();
+	if(options.denoise)
+	{
+		RayTracing::Denoiser().denoise(tracer->geometryBuffer(), &image);
+	}
+	auto encodeStart = std::chrono::steady_clock::now();
+	if(!options.pasteIntoFileName.empty())
+	{
+		pasteImage(image, region.x, region.y, &imagePlane.screen);
+		image = imagePlane.screen;
+	}
+	if(!ImageFiles::writeImage(fileName, image))
+	{
+		std::cerr << "Failed to write " << fileName << std::endl;
+		exit(-1);
+	}
+	auto encodeEnd = std::chrono::steady_clock::now();
+
+	std::cout << "Rendered in " << std::chrono::duration<double, std::milli>(denoiseStart - renderStart).count() << " ms, ";
+	if(options.denoise)
+	{
+		std::cout << "denoised in " << std::chrono::duration<double, std::milli>(encodeStart - denoiseStart).count() << " ms, ";
+	}
+	std::cout << "encoded in " << std::chrono::duration<double, std::milli>(encodeEnd - encodeStart).count() << " ms" << std::endl;
+	PROFILE_WRITE_CHROME_TRACE("rayTracer_trace.json");
+}
+
+namespace
+{
+	void parseCommandLineArguments(int ac, char** av, int* width, int* height, std::string* fileName, 
+		std::list<std::shared_ptr<RayTracing::I_IntersectableShape>>* scene, RenderOptions* options)
+	{
+		if(ac < 4)
+		{
+			exitWithUsage("Wrong number of arguments.");
+		}
+		else
+		{
+			std::string resolution(av[1]);
+			*width = std::stoi(resolution.substr(0, resolution.find("x")));
+			*height = std::stoi(resolution.substr(resolution.find("x") + 1, resolution.length()));
+			if(*width <= 0 || *height <= 0)
+			{
+				exitWithUsage("Resolution must be greater than zero.");
+			}
+
+			*fileName = av[3];
+
+			if(!sceneNamed(av[2], scene))
+			{
+				exitWithUsage("Unrecognized scene complexity.");
+			}
+
+			for(int i = 4; i < ac; i++)
+			{
+				if(strcmp(av[i], "--checkerboard") == 0)
+				{
+					options->checkerboard = true;
+				}
+				else if(strcmp(av[i], "--denoise") == 0)
+				{
+					options->denoise = true;
+				}
+				else if(strcmp(av[i], "--specialised") == 0)
+				{
+					options->specialised = true;
+				}
+				else if(strcmp(av[i], "--lights") == 0 && i + 1 < ac)
+				{
+					options->numberOfLights = std::stoi(av[++i]);
+				}
+				else if(strcmp(av[i], "--light-samples") == 0 && i + 1 < ac)
+				{
+					options->maximumLightSamplesPerPoint = std::stoi(av[++i]);
+					if(options->maximumLightSamplesPerPoint <= 0)
+					{
+						exitWithUsage("Light samples must be greater than zero.");
+					}
+				}
+				else if(strcmp(av[i], "--crop") == 0 && i + 1 < ac)
+				{
+					RayTracing::RayTracer::PixelRectangle crop;
+					if(!parsePixelRectangle(av[++i], &crop))
+					{
+						exitWithUsage("Crop must be \"INT,INT,INT,INT\".");
+					}
+					if(crop.x < 0 || crop.y < 0 || crop.width <= 0 || crop.height <= 0
+						|| crop.x + crop.width > *width || crop.y + crop.height > *height)
+					{
+						exitWithUsage("Crop must lie inside the image.");
+					}
+					options->crop = crop;
+				}
+				else if(strcmp(av[i], "--paste-into") == 0 && i + 1 < ac)
+				{
+					options->pasteIntoFileName = av[++i];
+				}
+				else
+				{
+					exitWithUsage("Unrecognized option " + std::string(av[i]) + ".");
+				}
+			}
+		}
+	}
+
+	std::shared_ptr<RayTracing::RayTracer> makeRayTracer(
+		const std::list<std::shared_ptr<RayTracing::I_IntersectableShape>>& scene, bool specialised)
+	{
+		if(specialised)
+		{
+			auto specialisedScene = SpecialisedScene::fromObjects(scene);
+			if(specialisedScene != NULL)
+			{
+				return std::make_shared<RayTracing::RayTracer>(scene, specialisedScene);
+			}
+			std::cout << "Scene has shapes other than spheres and quadrilaterals, so it cannot be specialised" << std::endl;
+		}
+		return std::make_shared<RayTracing::RayTracer>(scene);
+	}
+
+	void runRegressionSuite(int ac, char** av)
+	{
+		if(ac < 3)
+		{
+			exitWithUsage("Missing reference directory.");
+		}
+
+		RegressionSuite::Settings settings;
+		settings.referenceDirectory = av[2];
+		bool specialised = false;
+		for(int i = 3; i < ac; i++)
+		{
+			if(strcmp(av[i], "--update") == 0)
+			{
+				settings.updateReferences = true;
+			}
+			else if(strcmp(av[i], "--specialised") == 0)
+			{
+				specialised = true;
+			}
+			else if(strcmp(av[i], "--tolerance") == 0 && i + 1 < ac)
+			{
+				settings.channelTolerance = std::stoi(av[++i]);
+			}
+			else if(strcmp(av[i], "--max-slowdown") == 0 && i + 1 < ac)
+			{
+				settings.allowedSlowdownPercentage = std::stof(av[++i]);
+			}
+			else
+			{
+				exitWithUsage("Unrecognized option " + std::string(av[i]) + ".");
+			}
+		}
+
+		auto prepareRender = [specialised](const std::string& sceneName, int width, int height)
+		{
+			std::list<std::shared_ptr<RayTracing::I_IntersectableShape>> scene;
+			sceneNamed(sceneName, &scene);
+			auto tracer = makeRayTracer(scene, specialised);
+			auto imagePlane = std::make_shared<RayTracing::ImagePlane>(RayTracing::makeImagePlane(
+				eyePosition, lookingDirection, up, width, height, planeWidth, planeHeight, eyeToImagePlane));
+			return RegressionSuite::RenderFunction([tracer, imagePlane]()
+			{
+				return tracer->renderSceneGivenParameters(eyePosition, lightPosition, *imagePlane);
+			});
+		};
+
+		exit(RegressionSuite::run(SCENE_NAMES, prepareRender, settings) ? 0 : -1);
+	}
+
+	bool sceneNamed(const std::string& name, std::list<std::shared_ptr<RayTracing::I_IntersectableShape>>* scene)
+	{
+		if(name == "low")
+		{
+			*scene = Scenes::simpleScene();
+		}
+		else if(name == "medium")
+		{
+			*scene = Scenes::mediumComplexityScene();
+		}
+		else if(name == "high")
+		{
+			*scene = Scenes::complexScene();
+		}
+		else if(name == "cloud")
+		{
+			*scene = Scenes::sphereCloudScene();
+		}
+		else if(name == "sponge")
+		{
+			*scene = Scenes::mengerSpongeScene();
+		}
+		else
+		{
+			return false;
+		}
+		return true;
+	}
+
+	bool parsePixelRectangle(const std::string& text, RayTracing::RayTracer::PixelRectangle* rectangle)
+	{
+		std::istringstream stream(text);
+		char separators[3];
+		stream >> rectangle->x >> separators[0] >> rectangle->y >> separators[1]
+			>> rectangle->width >> separators[2] >> rectangle->height;
+		return stream && stream.peek() == EOF
+			&& separators[0] == ',' && separators[1] == ',' && separators[2] == ',';
+	}
+
+	void pasteImage(const geometry::Grid2<raster::RGB>& image, int x, int y, geometry::Grid2<raster::RGB>* destination)
+	{
+		for(int imageX = 0; imageX < image.width(); imageX++)
+		{
+			for(int imageY = 0; imageY < image.height(); imageY++)
+			{
+				(*destination)({x + imageX, y + imageY}) = image({imageX, imageY});
+			}
+		}
+	}
+
+	void exitWithUsage(const std::string& error)
+	{
+		std::cerr << "Error in arguments. " << error << std::endl;
+		std::cerr << 
+		R"(
+		Usage: ./AssignmentThree_EvanHampton resolution scene_complexity output_file_name [options]
+		   or: ./AssignmentThree_EvanHampton --regression reference_directory [regression_options]
+			
+			-resolution: "INTxINT"
+			-scene_complexity: "low", "medium", "high", "cloud", or "sponge"
+			-output_file_name: "AnythingYourHeartDesires.png". Ending in .ppm writes an uncompressed pixmap, and
+				.raw writes bare RGB bytes.
+
+			options:
+			--checkerboard: Trace every other pixel and reconstruct the rest. About twice as fast, but softens edges.
+			--denoise: Smooth the noise of cheap renders, such as checkerboard ones, without blurring across edges.
+			--specialised: Trace scenes made only of spheres and quadrilaterals with code specialised for those shapes.
+			--lights INT: Light the scene with INT scattered lights of limited reach instead of the single light.
+			--light-samples INT: Most lights shadow tested per point. Points reached by more are lit by a random
+				choice of INT of them. Defaults to 16.
+			--crop X,Y,WIDTH,HEIGHT: Only trace the given rectangle of pixels, and write just that rectangle.
+			--paste-into FILE: With --crop, paste the rectangle into FILE, an existing pixmap (.ppm) of the same
+				resolution, and write the result instead.
+
+			regression_options:
+			--update: Render every scene and store the images and timings as the new references.
+			--specialised: As above. The references of the general path apply, since the images should not change.
+			--tolerance INT: Largest difference allowed in a colour channel of a pixel. Defaults to 2.
+			--max-slowdown FLOAT: Percentage by which a render may be slower than its baseline. Defaults to 10.
+		)"<< std::endl;
+
+		exit(-1);
+	}
+}
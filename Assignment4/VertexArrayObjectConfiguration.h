@@ -1,11 +1,11 @@
-#pragma once
-
-#include "glad/glad.h"
-
-namespace GLUtility
-{
-	GLuint createVertexArrayObject();
-	GLuint createBufferObject();
-
-	void setupVertexArrayObject(GLuint vertexArrayObjectId, GLuint vertexBufferId);
+#pragma once
+
+#include "glad/glad.h"
+
+namespace GLUtility
+{
+	GLuint createVertexArrayObject();
+	GLuint createBufferObject();
+
+	void setupVertexArrayObject(GLuint vertexArrayObjectId, GLuint vertexBufferId);
 }
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <string>
+
+//The timing loop shared by the benchmark executables. Each operation is called with the index of the inputs to use,
+//NUMBER_OF_INPUTS indices per pass, and stores its result in an array so that the work can't be optimised away.
+//The fastest of a few attempts is kept, to leave out interruptions.
+namespace BenchmarkHarness
+{
+	const int NUMBER_OF_INPUTS = 4096;
+	const int NUMBER_OF_ATTEMPTS = 5;
+	const int REPETITIONS_PER_ATTEMPT = 400;
+
+	//Only counts anything in an executable that replaces operator new to increment it
+	inline long long numberOfAllocations = 0;
+
+	struct Measurement
+	{
+		double nanosecondsPerOperation;
+		double allocationsPerOperation;
+	};
+
+	template<typename Operation>
+	Measurement measure(const Operation& operation);
+	template<typename Operation>
+	double nanosecondsPerOperation(const Operation& operation);
+
+	//Reading a result keeps the compiler from dropping the stores to the result arrays
+	template<typename Result>
+	void keepResult(Result result);
+}
+
+template<typename Operation>
+BenchmarkHarness::Measurement BenchmarkHarness::measure(const Operation& operation)
+{
+	const int operationsPerAttempt = NUMBER_OF_INPUTS * REPETITIONS_PER_ATTEMPT;
+	double fastest = std::numeric_limits<double>::infinity();
+	long long allocations = 0;
+	for(int attempt = 0; attempt < NUMBER_OF_ATTEMPTS; attempt++)
+	{
+		const long long allocationsBefore = numberOfAllocations;
+		const auto start = std::chrono::steady_clock::now();
+		for(int repetition = 0; repetition < REPETITIONS_PER_ATTEMPT; repetition++)
+		{
+			for(int i = 0; i < NUMBER_OF_INPUTS; i++)
+			{
+				operation(i);
+			}
+		}
+		const auto end = std::chrono::steady_clock::now();
+		allocations = numberOfAllocations - allocationsBefore;
+		fastest = std::min(fastest, std::chrono::duration<double, std::nano>(end - start).count() / operationsPerAttempt);
+	}
+	return Measurement{fastest, static_cast<double>(allocations) / operationsPerAttempt};
+}
+
+template<typename Operation>
+double BenchmarkHarness::nanosecondsPerOperation(const Operation& operation)
+{
+	return measure(operation).nanosecondsPerOperation;
+}
+
+template<typename Result>
+void BenchmarkHarness::keepResult(Result result)
+{
+	volatile Result sink = result;
+	(void)sink;
+}
\ No newline at end of file
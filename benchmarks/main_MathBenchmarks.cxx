@@ -0,0 +1,277 @@
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmarks/BenchmarkHarness.h"
+#include "math/AffineTransform.h"
+#include "math/BatchTransforms.h"
+#include "math/LinearMath.h"
+#include "math/Matrices.h"
+#include "math/Matrix.h"
+#include "math/MatrixExpressions.h"
+#include "math/Vector.h"
+
+//Times the vector operations that the ray tracer and the mesh code spend their time in, for the SIMD float
+//specialisation of Vector<3> against a copy of the generic Vector<3>, which calculates one component at a time,
+//and the float 4x4 matrix operations against the generic Matrix code they replace. The inverses are all timed
+//against the general inverse as it was; the transformations are rotations and translations, so all three apply.
+//Lazy matrix expressions are timed against the same chain multiplied out one matrix at a time, and the batch
+//transformation of points stored as one array per coordinate against transforming them one at a time. The affine
+//transform type is timed against the 4x4 matrices it stands in for, and the approximate normalization against
+//the exact one.
+//Build with optimisations, e.g. g++ -std=c++17 -O2 -I. benchmarks/main_MathBenchmarks.cxx, and add
+//-DMATH_TYPES_DISABLE_SIMD to time the specialisation without SIMD.
+
+namespace
+{
+	using BenchmarkHarness::NUMBER_OF_INPUTS;
+	using BenchmarkHarness::nanosecondsPerOperation;
+
+	//LinearMath::inverse as it was before it shared the 2x2 minors of its cofactors
+	MathTypes::Matrix<4, 4, float> inverseByCofactorMatrices(const MathTypes::Matrix<4, 4, float>& matrix)
+	{
+		auto det = [](const MathTypes::Matrix<3, 3, float>& matrix)
+		{
+			return LinearMath::determinant(matrix);
+		};
+		using mat = MathTypes::Matrix<3, 3, float>;
+		auto& m = matrix;
+
+		float data[4][4] =
+		{
+			{det(mat({{m[1][1], m[1][2], m[1][3]}, {m[2][1], m[2][2], m[2][3]}, {m[3][1], m[3][2], m[3][3]}})),
+				-1*det(mat({{m[1][0], m[1][2], m[1][3]}, {m[2][0], m[2][2], m[2][3]}, {m[3][0], m[3][2], m[3][3]}})),
+				det(mat({{m[1][0], m[1][1], m[1][3]}, {m[2][0], m[2][1], m[2][3]}, {m[3][0], m[3][1], m[3][3]}})),
+				-1*det(mat({{m[1][0], m[1][1], m[1][2]}, {m[2][0], m[2][1], m[2][2]}, {m[3][0], m[3][1], m[3][2]}}))},
+			{-1*det(mat({{m[0][1], m[0][2], m[0][3]}, {m[2][1], m[2][2], m[2][3]}, {m[3][1], m[3][2], m[3][3]}})),
+				det(mat({{m[0][0], m[0][2], m[0][3]}, {m[2][0], m[2][2], m[2][3]}, {m[3][0], m[3][2], m[3][3]}})),
+				-1*det(mat({{m[0][0], m[0][1], m[0][3]}, {m[2][0], m[2][1], m[2][3]}, {m[3][0], m[3][1], m[3][3]}})),
+				det(mat({{m[0][0], m[0][1], m[0][2]}, {m[2][0], m[2][1], m[2][2]}, {m[3][0], m[3][1], m[3][2]}}))},
+			{det(mat({{m[0][1], m[0][2], m[0][3]}, {m[1][1], m[1][2], m[1][3]}, {m[3][1], m[3][2], m[3][3]}})),
+				-1*det(mat({{m[0][0], m[0][2], m[0][3]}, {m[1][0], m[1][2], m[1][3]}, {m[3][0], m[3][2], m[3][3]}})),
+				det(mat({{m[0][0], m[0][1], m[0][3]}, {m[1][0], m[1][1], m[1][3]}, {m[3][0], m[3][1], m[3][3]}})),
+				-1*det(mat({{m[0][0], m[0][1], m[0][2]}, {m[1][0], m[1][1], m[1][2]}, {m[3][0], m[3][1], m[3][2]}}))},
+			{-1*det(mat({{m[0][1], m[0][2], m[0][3]}, {m[1][1], m[1][2], m[1][3]}, {m[2][1], m[2][2], m[2][3]}})),
+				det(mat({{m[0][0], m[0][2], m[0][3]}, {m[1][0], m[1][2], m[1][3]}, {m[2][0], m[2][2], m[2][3]}})),
+				-1*det(mat({{m[0][0], m[0][1], m[0][3]}, {m[1][0], m[1][1], m[1][3]}, {m[2][0], m[2][1], m[2][3]}})),
+				det(mat({{m[0][0], m[0][1], m[0][2]}, {m[1][0], m[1][1], m[1][2]}, {m[2][0], m[2][1], m[2][2]}}))}
+		};
+
+		return (1/LinearMath::determinant(matrix)) * MathTypes::Matrix<4, 4, float>(data).transpose();
+	}
+
+	//The generic Vector<3, float> as it was before the specialisation
+	struct ComponentwiseVector
+	{
+		float x;
+		float y;
+		float z;
+	};
+
+	ComponentwiseVector operator+(const ComponentwiseVector& lhs, const ComponentwiseVector& rhs)
+	{
+		return ComponentwiseVector{lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z};
+	}
+
+	ComponentwiseVector operator-(const ComponentwiseVector& lhs, const ComponentwiseVector& rhs)
+	{
+		return ComponentwiseVector{lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z};
+	}
+
+	ComponentwiseVector operator*(const ComponentwiseVector& lhs, double scalar)
+	{
+		return ComponentwiseVector{
+			static_cast<float>(lhs.x * scalar), static_cast<float>(lhs.y * scalar), static_cast<float>(lhs.z * scalar)};
+	}
+
+	float dotProduct(const ComponentwiseVector& lhs, const ComponentwiseVector& rhs)
+	{
+		return (lhs.x * rhs.x) + (lhs.y * rhs.y) + (lhs.z * rhs.z);
+	}
+
+	ComponentwiseVector crossProduct(const ComponentwiseVector& lhs, const ComponentwiseVector& rhs)
+	{
+		const float iScalar = (lhs.y * rhs.z) - (lhs.z * rhs.y);
+		const float jScalar = (lhs.x * rhs.z) - (lhs.z * rhs.x);
+		const float kScalar = (lhs.x * rhs.y) - (lhs.y * rhs.x);
+		return ComponentwiseVector{iScalar, -1 * jScalar, kScalar};
+	}
+
+	ComponentwiseVector normalized(const ComponentwiseVector& vector)
+	{
+		const float normalizingScalar = 1.0 / std::sqrt(dotProduct(vector, vector));
+		return vector * normalizingScalar;
+	}
+
+	ComponentwiseVector componentwise(const MathTypes::Vector<3, float>& vector)
+	{
+		return ComponentwiseVector{vector.xValue(), vector.yValue(), vector.zValue()};
+	}
+
+	void reportComparison(const std::string& name, double componentwise, double specialised)
+	{
+		printf("%-24s %8.2f ns %8.2f ns %7.2fx\n", name.c_str(), componentwise, specialised, componentwise / specialised);
+	}
+}
+
+int main()
+{
+	std::mt19937 generator(453);
+	std::uniform_real_distribution<float> coordinate(-10, 10);
+	std::vector<MathTypes::Vector<3, float>> as, bs;
+	std::vector<ComponentwiseVector> componentwiseAs, componentwiseBs;
+	for(int i = 0; i < NUMBER_OF_INPUTS; i++)
+	{
+		as.emplace_back(coordinate(generator), coordinate(generator), coordinate(generator));
+		bs.emplace_back(coordinate(generator), coordinate(generator), coordinate(generator));
+		componentwiseAs.push_back(componentwise(as.back()));
+		componentwiseBs.push_back(componentwise(bs.back()));
+	}
+	const float floatScalar = 0.5;
+	const double doubleScalar = 0.1;
+
+#if defined(MATH_TYPES_USE_SSE)
+	printf("Vector<3, float> uses SSE\n");
+#elif defined(MATH_TYPES_USE_NEON)
+	printf("Vector<3, float> uses NEON\n");
+#else
+	printf("Vector<3, float> uses no SIMD\n");
+#endif
+	printf("%-24s %11s %11s %8s\n", "operation", "generic", "specialised", "speedup");
+
+	//Results of each operation, which are written to memory like the results of the real code would be
+	std::vector<MathTypes::Vector<3, float>> vectorResults(NUMBER_OF_INPUTS, MathTypes::Vector<3, float>(0, 0, 0));
+	std::vector<ComponentwiseVector> componentwiseResults(NUMBER_OF_INPUTS);
+	std::vector<float> scalarResults(NUMBER_OF_INPUTS);
+
+	reportComparison("a + b",
+		nanosecondsPerOperation([&](int i) { componentwiseResults[i] = componentwiseAs[i] + componentwiseBs[i]; }),
+		nanosecondsPerOperation([&](int i) { vectorResults[i] = as[i] + bs[i]; }));
+	reportComparison("a - b",
+		nanosecondsPerOperation([&](int i) { componentwiseResults[i] = componentwiseAs[i] - componentwiseBs[i]; }),
+		nanosecondsPerOperation([&](int i) { vectorResults[i] = as[i] - bs[i]; }));
+	reportComparison("a * float",
+		nanosecondsPerOperation([&](int i) { componentwiseResults[i] = componentwiseAs[i] * floatScalar; }),
+		nanosecondsPerOperation([&](int i) { vectorResults[i] = as[i] * floatScalar; }));
+	reportComparison("a * double",
+		nanosecondsPerOperation([&](int i) { componentwiseResults[i] = componentwiseAs[i] * doubleScalar; }),
+		nanosecondsPerOperation([&](int i) { vectorResults[i] = as[i] * doubleScalar; }));
+	reportComparison("dotProduct(a, b)",
+		nanosecondsPerOperation([&](int i) { scalarResults[i] = dotProduct(componentwiseAs[i], componentwiseBs[i]); }),
+		nanosecondsPerOperation([&](int i) { scalarResults[i] = LinearMath::dotProduct(as[i], bs[i]); }));
+	reportComparison("crossProduct(a, b)",
+		nanosecondsPerOperation([&](int i) { componentwiseResults[i] = crossProduct(componentwiseAs[i], componentwiseBs[i]); }),
+		nanosecondsPerOperation([&](int i) { vectorResults[i] = LinearMath::crossProduct(as[i], bs[i]); }));
+	reportComparison("a.normalized()",
+		nanosecondsPerOperation([&](int i) { componentwiseResults[i] = normalized(componentwiseAs[i]); }),
+		nanosecondsPerOperation([&](int i) { vectorResults[i] = as[i].normalized(); }));
+	reportComparison("fastNormalized(a)",
+		nanosecondsPerOperation([&](int i) { vectorResults[i] = as[i].normalized(); }),
+		nanosecondsPerOperation([&](int i) { vectorResults[i] = LinearMath::fastNormalized(as[i]); }));
+	//The reflection of the ray tracer's shading, which chains most of the above
+	reportComparison("reflection",
+		nanosecondsPerOperation([&](int i)
+		{
+			const auto normal = normalized(componentwiseAs[i]);
+			const auto toEye = normalized(componentwiseBs[i]);
+			componentwiseResults[i] = (normal - toEye) * (2 * dotProduct(toEye, normal));
+		}),
+		nanosecondsPerOperation([&](int i)
+		{
+			const auto normal = as[i].normalized();
+			const auto toEye = bs[i].normalized();
+			vectorResults[i] = 2 * LinearMath::dotProduct(toEye, normal) * (normal - toEye);
+		}));
+
+	std::vector<MathTypes::Matrix<4, 4, float>> transformations;
+	for(int i = 0; i < NUMBER_OF_INPUTS; i++)
+	{
+		transformations.push_back(Matrices::translationMatrix3D<float>(
+				coordinate(generator), coordinate(generator), coordinate(generator))
+			* Matrices::rotateAboutLine<float>(as[i], coordinate(generator)));
+	}
+	std::vector<MathTypes::Matrix<4, 4, float>> matrixResults(NUMBER_OF_INPUTS, Matrices::identityMatrix3D<float>());
+
+	reportComparison("matrix * matrix",
+		nanosecondsPerOperation([&](int i)
+		{
+			matrixResults[i] = operator*<4, 4, 4, 4, float>(
+				transformations[i], transformations[(i + 1) % NUMBER_OF_INPUTS]);
+		}),
+		nanosecondsPerOperation([&](int i)
+		{
+			matrixResults[i] = transformations[i] * transformations[(i + 1) % NUMBER_OF_INPUTS];
+		}));
+	reportComparison("transformPoint",
+		nanosecondsPerOperation([&](int i)
+		{
+			const auto product = transformations[i] * static_cast<MathTypes::Matrix<4, 1, float>>(as[i].homogenized());
+			vectorResults[i] = MathTypes::Vector<3, float>(product[0][0], product[1][0], product[2][0]);
+		}),
+		nanosecondsPerOperation([&](int i) { vectorResults[i] = LinearMath::transformPoint(transformations[i], as[i]); }));
+	std::vector<float> xs, ys, zs;
+	for(const auto& a : as)
+	{
+		xs.push_back(a.xValue());
+		ys.push_back(a.yValue());
+		zs.push_back(a.zValue());
+	}
+	//The batch transforms every point on the first call of a pass, so its time is spread over all of them
+	reportComparison("transformPoints",
+		nanosecondsPerOperation([&](int i) { vectorResults[i] = LinearMath::transformPoint(transformations[0], as[i]); }),
+		nanosecondsPerOperation([&](int i)
+		{
+			if(i == 0)
+			{
+				LinearMath::transformPoints(transformations[0], xs.data(), ys.data(), zs.data(), NUMBER_OF_INPUTS);
+			}
+		}));
+	reportComparison("lazy(a) * b * c * point",
+		nanosecondsPerOperation([&](int i)
+		{
+			const auto product = transformations[i] * transformations[(i + 1) % NUMBER_OF_INPUTS]
+				* transformations[(i + 2) % NUMBER_OF_INPUTS]
+				* static_cast<MathTypes::Matrix<4, 1, float>>(as[i].homogenized());
+			vectorResults[i] = MathTypes::Vector<3, float>(product[0][0], product[1][0], product[2][0]);
+		}),
+		nanosecondsPerOperation([&](int i)
+		{
+			const auto product = MatrixExpressions::lazy(transformations[i]) * transformations[(i + 1) % NUMBER_OF_INPUTS]
+				* transformations[(i + 2) % NUMBER_OF_INPUTS] * as[i].homogenized();
+			vectorResults[i] = MathTypes::Vector<3, float>(product.xValue(), product.yValue(), product.zValue());
+		}));
+
+	reportComparison("inverse",
+		nanosecondsPerOperation([&](int i) { matrixResults[i] = inverseByCofactorMatrices(transformations[i]); }),
+		nanosecondsPerOperation([&](int i) { matrixResults[i] = LinearMath::inverse(transformations[i]); }));
+	reportComparison("affineInverse",
+		nanosecondsPerOperation([&](int i) { matrixResults[i] = inverseByCofactorMatrices(transformations[i]); }),
+		nanosecondsPerOperation([&](int i) { matrixResults[i] = LinearMath::affineInverse(transformations[i]); }));
+	reportComparison("rigidInverse",
+		nanosecondsPerOperation([&](int i) { matrixResults[i] = inverseByCofactorMatrices(transformations[i]); }),
+		nanosecondsPerOperation([&](int i) { matrixResults[i] = LinearMath::rigidInverse(transformations[i]); }));
+
+	std::vector<MathTypes::AffineTransform<float>> affineTransformations, affineResults;
+	for(const auto& transformation : transformations)
+	{
+		affineTransformations.emplace_back(transformation);
+	}
+	affineResults = affineTransformations;
+	reportComparison("affine * affine",
+		nanosecondsPerOperation([&](int i)
+		{
+			matrixResults[i] = transformations[i] * transformations[(i + 1) % NUMBER_OF_INPUTS];
+		}),
+		nanosecondsPerOperation([&](int i)
+		{
+			affineResults[i] = affineTransformations[i] * affineTransformations[(i + 1) % NUMBER_OF_INPUTS];
+		}));
+	reportComparison("inverse(affine)",
+		nanosecondsPerOperation([&](int i) { matrixResults[i] = LinearMath::affineInverse(transformations[i]); }),
+		nanosecondsPerOperation([&](int i) { affineResults[i] = LinearMath::inverse(affineTransformations[i]); }));
+
+	BenchmarkHarness::keepResult(vectorResults[0].xValue() + componentwiseResults[0].x + scalarResults[0]
+		+ matrixResults[0][0][0] + xs[0] + affineResults[0][0][0]);
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmarks/BenchmarkHarness.h"
+#include "math/LinearMath.h"
+#include "math/Matrices.h"
+#include "math/Matrix.h"
+#include "math/Vector.h"
+
+//Times the operations of math/ on their own, in float and in double, and counts the heap allocations each one
+//makes, which should all be zero, as the math types keep their components inline.
+//Build with optimisations, e.g. g++ -std=c++17 -O2 -I. benchmarks/main_MathSuite.cxx, and add
+//-DMATH_TYPES_DISABLE_SIMD to time the float specialisations without SIMD.
+
+namespace
+{
+	using BenchmarkHarness::NUMBER_OF_INPUTS;
+	using BenchmarkHarness::measure;
+	using BenchmarkHarness::Measurement;
+
+	void report(const std::string& name, const Measurement& measurement)
+	{
+		printf("%-28s %10.2f ns %12.3f\n", name.c_str(), measurement.nanosecondsPerOperation,
+			measurement.allocationsPerOperation);
+	}
+
+	//A matrix with a large diagonal, so that it is always comfortably invertible
+	template<int dimensions, typename CoordinatePrimitive, typename Generator>
+	MathTypes::Matrix<dimensions, dimensions, CoordinatePrimitive> randomMatrix(Generator& generator)
+	{
+		std::uniform_real_distribution<CoordinatePrimitive> entry(-1, 1);
+		std::array<std::array<CoordinatePrimitive, dimensions>, dimensions> data = {};
+		for(int i = 0; i < dimensions; i++)
+		{
+			for(int j = 0; j < dimensions; j++)
+			{
+				data[i][j] = entry(generator) + (i == j ? dimensions : 0);
+			}
+		}
+		return MathTypes::Matrix<dimensions, dimensions, CoordinatePrimitive>(data);
+	}
+
+	template<int dimensions, typename CoordinatePrimitive, typename Generator>
+	void measureMatrixOperations(Generator& generator)
+	{
+		using MatrixType = MathTypes::Matrix<dimensions, dimensions, CoordinatePrimitive>;
+		std::vector<MatrixType> matrices;
+		for(int i = 0; i < NUMBER_OF_INPUTS; i++)
+		{
+			matrices.push_back(randomMatrix<dimensions, CoordinatePrimitive>(generator));
+		}
+		std::vector<MatrixType> matrixResults(matrices);
+		std::vector<CoordinatePrimitive> scalarResults(NUMBER_OF_INPUTS);
+
+		const std::string size = std::to_string(dimensions) + "x" + std::to_string(dimensions);
+		report("matrix * matrix " + size, measure([&](int i)
+		{
+			matrixResults[i] = matrices[i] * matrices[(i + 1) % NUMBER_OF_INPUTS];
+		}));
+		report("determinant " + size, measure([&](int i)
+		{
+			scalarResults[i] = LinearMath::determinant(matrices[i]);
+		}));
+		report("inverse " + size, measure([&](int i) { matrixResults[i] = LinearMath::inverse(matrices[i]); }));
+
+		BenchmarkHarness::keepResult(matrixResults[0][0][0] + scalarResults[0]);
+	}
+
+	template<typename CoordinatePrimitive>
+	void measureAllOperations(const char* typeName)
+	{
+		using T = CoordinatePrimitive;
+		using Vector2 = MathTypes::Vector<2, T>;
+		using Vector3 = MathTypes::Vector<3, T>;
+
+		std::mt19937 generator(453);
+		std::uniform_real_distribution<T> coordinate(-10, 10);
+		std::vector<Vector2> as2, bs2;
+		std::vector<Vector3> as3, bs3;
+		std::vector<T> angles;
+		for(int i = 0; i < NUMBER_OF_INPUTS; i++)
+		{
+			as2.emplace_back(coordinate(generator), coordinate(generator));
+			bs2.emplace_back(coordinate(generator), coordinate(generator));
+			as3.emplace_back(coordinate(generator), coordinate(generator), coordinate(generator));
+			bs3.emplace_back(coordinate(generator), coordinate(generator), coordinate(generator));
+			angles.push_back(coordinate(generator) * 18);
+		}
+		const double scalar = 0.1;
+
+		printf("\n%s\n", typeName);
+		printf("%-28s %13s %12s\n", "operation", "time", "allocations");
+
+		//Results of each operation, which are written to memory like the results of the real code would be
+		std::vector<Vector2> vector2Results(as2);
+		std::vector<Vector3> vector3Results(as3);
+		std::vector<T> scalarResults(NUMBER_OF_INPUTS);
+		std::vector<MathTypes::Matrix<4, 4, T>> matrixResults(NUMBER_OF_INPUTS, Matrices::identityMatrix3D<T>());
+
+		report("a + b 2D", measure([&](int i) { vector2Results[i] = as2[i] + bs2[i]; }));
+		report("a - b 2D", measure([&](int i) { vector2Results[i] = as2[i] - bs2[i]; }));
+		report("a * scalar 2D", measure([&](int i) { vector2Results[i] = as2[i] * scalar; }));
+		report("a.normalized() 2D", measure([&](int i) { vector2Results[i] = as2[i].normalized(); }));
+		report("dotProduct(a, b) 2D", measure([&](int i) { scalarResults[i] = LinearMath::dotProduct(as2[i], bs2[i]); }));
+		report("a + b 3D", measure([&](int i) { vector3Results[i] = as3[i] + bs3[i]; }));
+		report("a - b 3D", measure([&](int i) { vector3Results[i] = as3[i] - bs3[i]; }));
+		report("a * scalar 3D", measure([&](int i) { vector3Results[i] = as3[i] * scalar; }));
+		report("a.normalized() 3D", measure([&](int i) { vector3Results[i] = as3[i].normalized(); }));
+		report("dotProduct(a, b) 3D", measure([&](int i) { scalarResults[i] = LinearMath::dotProduct(as3[i], bs3[i]); }));
+		report("crossProduct(a, b)", measure([&](int i)
+		{
+			vector3Results[i] = LinearMath::crossProduct(as3[i], bs3[i]);
+		}));
+
+		measureMatrixOperations<2, T>(generator);
+		measureMatrixOperations<3, T>(generator);
+		measureMatrixOperations<4, T>(generator);
+
+		report("rotateAboutLine", measure([&](int i) { matrixResults[i] = Matrices::rotateAboutLine(as3[i], angles[i]); }));
+		report("lookAtMatrix", measure([&](int i)
+		{
+			matrixResults[i] = Matrices::lookAtMatrix(as3[i], bs3[i], Vector3(0, 1, 0));
+		}));
+
+		BenchmarkHarness::keepResult(vector2Results[0].xValue() + vector3Results[0].xValue() + scalarResults[0]
+			+ matrixResults[0][0][0]);
+	}
+}
+
+//Counts every allocation, so that an operation that allocates shows up in the report
+void* operator new(std::size_t size)
+{
+	BenchmarkHarness::numberOfAllocations++;
+	void* memory = std::malloc(size == 0 ? 1 : size);
+	if(memory == NULL)
+	{
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+int main()
+{
+#if defined(MATH_TYPES_USE_SSE)
+	printf("The float specialisations use SSE\n");
+#elif defined(MATH_TYPES_USE_NEON)
+	printf("The float specialisations use NEON\n");
+#else
+	printf("The float specialisations use no SIMD\n");
+#endif
+
+	measureAllOperations<float>("float");
+	measureAllOperations<double>("double");
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <string>
+
+#include "math/LinearMath.h"
+#include "math/Matrix.h"
+#include "math/Vector.h"
+#include "math/VectorLanes.h"
+
+namespace MathTypes
+{
+	//A transformation whose 4x4 matrix has a bottom row of (0, 0, 0, 1), such as any product of the scale, rotation,
+	//translation and look at matrices, stored as only the upper three rows. Composing two costs 36 multiplications
+	//instead of the 64 of a 4x4 matrix product, and inverting one only inverts the upper left 3x3.
+	//Convert to a 4x4 matrix when it has to be combined with a projection.
+	template<typename CoordinatePrimitive>
+	class AffineTransform
+	{
+	public:
+		constexpr explicit AffineTransform(std::array<std::array<CoordinatePrimitive, 4>, 3> data);
+		//The bottom row of the matrix must be (0, 0, 0, 1)
+		constexpr explicit AffineTransform(const Matrix<4, 4, CoordinatePrimitive>& matrix);
+
+		static constexpr AffineTransform<CoordinatePrimitive> identity();
+
+		constexpr const std::array<CoordinatePrimitive, 4>& operator[](int row) const;
+		constexpr explicit operator Matrix<4, 4, CoordinatePrimitive>() const;
+
+		std::string toString() const;
+
+	private:
+		std::array<std::array<CoordinatePrimitive, 4>, 3> data_;
+	};
+}
+
+//The transformation rhs followed by the transformation lhs, like the product of their matrices
+template<typename CoordinatePrimitive>
+constexpr MathTypes::AffineTransform<CoordinatePrimitive> operator*(
+	const MathTypes::AffineTransform<CoordinatePrimitive>& lhs,
+	const MathTypes::AffineTransform<CoordinatePrimitive>& rhs);
+
+//Unrolled on SIMD lanes like the float 4x4 matrix product
+constexpr MathTypes::AffineTransform<float> operator*(
+	const MathTypes::AffineTransform<float>& lhs,
+	const MathTypes::AffineTransform<float>& rhs);
+
+template<typename CoordinatePrimitive>
+constexpr bool operator==(
+	const MathTypes::AffineTransform<CoordinatePrimitive>& lhs,
+	const MathTypes::AffineTransform<CoordinatePrimitive>& rhs);
+
+namespace LinearMath
+{
+	//The same results as affineInverse of the transformation as a 4x4 matrix
+	template<typename CoordinatePrimitive>
+	constexpr MathTypes::AffineTransform<CoordinatePrimitive> inverse(
+		const MathTypes::AffineTransform<CoordinatePrimitive>& transformation);
+
+	template<typename CoordinatePrimitive>
+	constexpr MathTypes::Vector<3, CoordinatePrimitive> transformPoint(
+		const MathTypes::AffineTransform<CoordinatePrimitive>& transformation,
+		const MathTypes::Vector<3, CoordinatePrimitive>& point);
+
+	template<typename CoordinatePrimitive>
+	constexpr MathTypes::Vector<3, CoordinatePrimitive> transformDirection(
+		const MathTypes::AffineTransform<CoordinatePrimitive>& transformation,
+		const MathTypes::Vector<3, CoordinatePrimitive>& direction);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::AffineTransform<CoordinatePrimitive>::AffineTransform(
+	std::array<std::array<CoordinatePrimitive, 4>, 3> data)
+	: data_(data)
+{
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::AffineTransform<CoordinatePrimitive>::AffineTransform(
+	const Matrix<4, 4, CoordinatePrimitive>& matrix)
+	: data_{{matrix[0], matrix[1], matrix[2]}}
+{
+	assert(matrix[3][0] == 0 && matrix[3][1] == 0 && matrix[3][2] == 0 && matrix[3][3] == 1);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::AffineTransform<CoordinatePrimitive> MathTypes::AffineTransform<CoordinatePrimitive>::identity()
+{
+	return AffineTransform<CoordinatePrimitive>(std::array<std::array<CoordinatePrimitive, 4>, 3>{{
+		{1, 0, 0, 0},
+		{0, 1, 0, 0},
+		{0, 0, 1, 0}
+	}});
+}
+
+template<typename CoordinatePrimitive>
+constexpr const std::array<CoordinatePrimitive, 4>& MathTypes::AffineTransform<CoordinatePrimitive>::operator[](
+	int row) const
+{
+	assert(row >= 0 && row < 3);
+
+	return data_[row];
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::AffineTransform<CoordinatePrimitive>::operator Matrix<4, 4, CoordinatePrimitive>() const
+{
+	return Matrix<4, 4, CoordinatePrimitive>(std::array<std::array<CoordinatePrimitive, 4>, 4>{
+		data_[0], data_[1], data_[2], {0, 0, 0, 1}});
+}
+
+template<typename CoordinatePrimitive>
+std::string MathTypes::AffineTransform<CoordinatePrimitive>::toString() const
+{
+	return "Affine Transform. " + Matrix<3, 4, CoordinatePrimitive>(data_).toString();
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::AffineTransform<CoordinatePrimitive> operator*(
+	const MathTypes::AffineTransform<CoordinatePrimitive>& lhs,
+	const MathTypes::AffineTransform<CoordinatePrimitive>& rhs)
+{
+	//The missing bottom row of rhs only adds the translation of lhs to the last column
+	std::array<std::array<CoordinatePrimitive, 4>, 3> data = {};
+	for(int i = 0; i < 3; i++)
+	{
+		for(int j = 0; j < 4; j++)
+		{
+			data[i][j] = lhs[i][0]*rhs[0][j] + lhs[i][1]*rhs[1][j] + lhs[i][2]*rhs[2][j];
+		}
+		data[i][3] += lhs[i][3];
+	}
+
+	return MathTypes::AffineTransform<CoordinatePrimitive>(data);
+}
+
+constexpr MathTypes::AffineTransform<float> operator*(
+	const MathTypes::AffineTransform<float>& lhs,
+	const MathTypes::AffineTransform<float>& rhs)
+{
+	using namespace MathTypes::VectorLanes;
+
+	//Row i of the product is the rows of rhs weighted by the entries of row i of lhs, plus its translation
+	const Lanes rhsRows[3] = {fromArray(rhs[0].data()), fromArray(rhs[1].data()), fromArray(rhs[2].data())};
+	std::array<std::array<float, 4>, 3> data = {};
+	for(int i = 0; i < 3; i++)
+	{
+		const auto& row = lhs[i];
+		Lanes currentSum = product(broadcast(row[0]), rhsRows[0]);
+		currentSum = sum(currentSum, product(broadcast(row[1]), rhsRows[1]));
+		currentSum = sum(currentSum, product(broadcast(row[2]), rhsRows[2]));
+		currentSum = sum(currentSum, fromComponents(0, 0, 0, row[3]));
+		toArray(currentSum, data[i].data());
+	}
+	return MathTypes::AffineTransform<float>(data);
+}
+
+template<typename CoordinatePrimitive>
+constexpr bool operator==(
+	const MathTypes::AffineTransform<CoordinatePrimitive>& lhs,
+	const MathTypes::AffineTransform<CoordinatePrimitive>& rhs)
+{
+	for(int i = 0; i < 3; i++)
+	{
+		for(int j = 0; j < 4; j++)
+		{
+			if(lhs[i][j] != rhs[i][j])
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::AffineTransform<CoordinatePrimitive> LinearMath::inverse(
+	const MathTypes::AffineTransform<CoordinatePrimitive>& transformation)
+{
+	using T = CoordinatePrimitive;
+	const auto& m = transformation;
+
+	//The upper left 3x3 is inverted on its own
+	const auto inverseOfLinearPart = inverseOfUpperLeft3x3(m[0], m[1], m[2]);
+
+	//Then the translation is undone after the inverted linear part, rather than before the original one
+	std::array<std::array<T, 4>, 3> data = {};
+	for(int i = 0; i < 3; i++)
+	{
+		const auto& row = inverseOfLinearPart[i];
+		data[i] = {row[0], row[1], row[2], -1*(row[0]*m[0][3] + row[1]*m[1][3] + row[2]*m[2][3])};
+	}
+
+	return MathTypes::AffineTransform<CoordinatePrimitive>(data);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Vector<3, CoordinatePrimitive> LinearMath::transformPoint(
+	const MathTypes::AffineTransform<CoordinatePrimitive>& transformation,
+	const MathTypes::Vector<3, CoordinatePrimitive>& point)
+{
+	const CoordinatePrimitive x = point.xValue();
+	const CoordinatePrimitive y = point.yValue();
+	const CoordinatePrimitive z = point.zValue();
+	const auto& firstRow = transformation[0];
+	const auto& secondRow = transformation[1];
+	const auto& thirdRow = transformation[2];
+
+	return MathTypes::Vector<3, CoordinatePrimitive>(
+		firstRow[0]*x + firstRow[1]*y + firstRow[2]*z + firstRow[3],
+		secondRow[0]*x + secondRow[1]*y + secondRow[2]*z + secondRow[3],
+		thirdRow[0]*x + thirdRow[1]*y + thirdRow[2]*z + thirdRow[3]);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Vector<3, CoordinatePrimitive> LinearMath::transformDirection(
+	const MathTypes::AffineTransform<CoordinatePrimitive>& transformation,
+	const MathTypes::Vector<3, CoordinatePrimitive>& direction)
+{
+	const CoordinatePrimitive x = direction.xValue();
+	const CoordinatePrimitive y = direction.yValue();
+	const CoordinatePrimitive z = direction.zValue();
+	const auto& firstRow = transformation[0];
+	const auto& secondRow = transformation[1];
+	const auto& thirdRow = transformation[2];
+
+	return MathTypes::Vector<3, CoordinatePrimitive>(
+		firstRow[0]*x + firstRow[1]*y + firstRow[2]*z,
+		secondRow[0]*x + secondRow[1]*y + secondRow[2]*z,
+		thirdRow[0]*x + thirdRow[1]*y + thirdRow[2]*z);
+}
\ No newline at end of file
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "math/LinearMath.h"
+#include "math/Matrix.h"
+#include "math/VectorLanes.h"
+
+//Transformation of many points or normals at once, stored as one array per coordinate, so that the float kernel
+//can transform four of them at a time on the SIMD lanes.
+namespace LinearMath
+{
+	//Splitting a batch between threads only pays off once each thread has about this many points to transform
+	const int MINIMUM_POINTS_PER_THREAD = 32768;
+
+	//Transforms the numberOfPoints points whose coordinates are x[i], y[i] and z[i] in place, with the same
+	//results as transformPoint as long as the compiler doesn't contract multiply-adds into FMA instructions
+	//(-ffp-contract=off, the default in the ISO dialects). With contraction, a result can differ from transformPoint
+	//in its last bits. The points are split between up to numberOfThreads threads.
+	template<typename CoordinatePrimitive>
+	void transformPoints(
+		const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformation,
+		CoordinatePrimitive* x,
+		CoordinatePrimitive* y,
+		CoordinatePrimitive* z,
+		int numberOfPoints,
+		int numberOfThreads = 1);
+
+	//Transforms the normals in place by the inverse transpose of the upper left 3x3 of the transformation, which
+	//keeps them perpendicular to the transformed surface when the transformation scales unevenly, and normalizes them
+	template<typename CoordinatePrimitive>
+	void transformNormals(
+		const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformation,
+		CoordinatePrimitive* x,
+		CoordinatePrimitive* y,
+		CoordinatePrimitive* z,
+		int numberOfNormals,
+		int numberOfThreads = 1);
+}
+
+namespace BatchTransformKernels
+{
+	//Transforms the points first to last - 1 by the upper three rows of the transformation, normalizing the
+	//results if asked to
+	template<typename CoordinatePrimitive>
+	void transformRange(
+		const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformation,
+		CoordinatePrimitive* x,
+		CoordinatePrimitive* y,
+		CoordinatePrimitive* z,
+		int first,
+		int last,
+		bool normalize);
+
+	inline void transformRange(
+		const MathTypes::Matrix<4, 4, float>& transformation,
+		float* x,
+		float* y,
+		float* z,
+		int first,
+		int last,
+		bool normalize);
+
+	//Calls task(first, last) on contiguous ranges that together cover 0 to numberOfItems - 1
+	template<typename RangeTask>
+	void splitBetweenThreads(int numberOfItems, int numberOfThreads, const RangeTask& task);
+}
+
+template<typename CoordinatePrimitive>
+void LinearMath::transformPoints(
+	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformation,
+	CoordinatePrimitive* x,
+	CoordinatePrimitive* y,
+	CoordinatePrimitive* z,
+	int numberOfPoints,
+	int numberOfThreads)
+{
+	BatchTransformKernels::splitBetweenThreads(numberOfPoints, numberOfThreads, [&](int first, int last)
+	{
+		BatchTransformKernels::transformRange(transformation, x, y, z, first, last, false);
+	});
+}
+
+template<typename CoordinatePrimitive>
+void LinearMath::transformNormals(
+	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformation,
+	CoordinatePrimitive* x,
+	CoordinatePrimitive* y,
+	CoordinatePrimitive* z,
+	int numberOfNormals,
+	int numberOfThreads)
+{
+	using T = CoordinatePrimitive;
+	const auto& m = transformation;
+
+	//Normals are transformed by the transpose of the inverse of the linear part, without any translation
+	const auto inverse = LinearMath::inverseOfUpperLeft3x3(m[0], m[1], m[2]);
+	const MathTypes::Matrix<4, 4, T> inverseTranspose({
+		{inverse[0][0], inverse[1][0], inverse[2][0], 0},
+		{inverse[0][1], inverse[1][1], inverse[2][1], 0},
+		{inverse[0][2], inverse[1][2], inverse[2][2], 0},
+		{0, 0, 0, 1}
+	});
+
+	BatchTransformKernels::splitBetweenThreads(numberOfNormals, numberOfThreads, [&](int first, int last)
+	{
+		BatchTransformKernels::transformRange(inverseTranspose, x, y, z, first, last, true);
+	});
+}
+
+template<typename CoordinatePrimitive>
+void BatchTransformKernels::transformRange(
+	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformation,
+	CoordinatePrimitive* x,
+	CoordinatePrimitive* y,
+	CoordinatePrimitive* z,
+	int first,
+	int last,
+	bool normalize)
+{
+	using T = CoordinatePrimitive;
+	const auto& firstRow = transformation[0];
+	const auto& secondRow = transformation[1];
+	const auto& thirdRow = transformation[2];
+
+	for(int i = first; i < last; i++)
+	{
+		const T oldX = x[i];
+		const T oldY = y[i];
+		const T oldZ = z[i];
+		T newX = firstRow[0]*oldX + firstRow[1]*oldY + firstRow[2]*oldZ + firstRow[3];
+		T newY = secondRow[0]*oldX + secondRow[1]*oldY + secondRow[2]*oldZ + secondRow[3];
+		T newZ = thirdRow[0]*oldX + thirdRow[1]*oldY + thirdRow[2]*oldZ + thirdRow[3];
+		if(normalize)
+		{
+			const T length = std::sqrt(newX*newX + newY*newY + newZ*newZ);
+			newX /= length;
+			newY /= length;
+			newZ /= length;
+		}
+		x[i] = newX;
+		y[i] = newY;
+		z[i] = newZ;
+	}
+}
+
+inline void BatchTransformKernels::transformRange(
+	const MathTypes::Matrix<4, 4, float>& transformation,
+	float* x,
+	float* y,
+	float* z,
+	int first,
+	int last,
+	bool normalize)
+{
+	using namespace MathTypes::VectorLanes;
+	Lanes coefficients[3][4] = {};
+	for(int row = 0; row < 3; row++)
+	{
+		for(int column = 0; column < 4; column++)
+		{
+			coefficients[row][column] = broadcast(transformation[row][column]);
+		}
+	}
+	//Each lane holds a different point, and sums its products in the same order as transformPoint
+	auto transformedCoordinate = [&](int row, Lanes oldX, Lanes oldY, Lanes oldZ)
+	{
+		const Lanes* c = coefficients[row];
+		return sum(sum(sum(product(c[0], oldX), product(c[1], oldY)), product(c[2], oldZ)), c[3]);
+	};
+	auto transformFourPoints = [&](float* fourX, float* fourY, float* fourZ)
+	{
+		const Lanes oldX = fromArray(fourX);
+		const Lanes oldY = fromArray(fourY);
+		const Lanes oldZ = fromArray(fourZ);
+		Lanes newX = transformedCoordinate(0, oldX, oldY, oldZ);
+		Lanes newY = transformedCoordinate(1, oldX, oldY, oldZ);
+		Lanes newZ = transformedCoordinate(2, oldX, oldY, oldZ);
+		if(normalize)
+		{
+			const Lanes lengths = squareRoot(sum(sum(product(newX, newX), product(newY, newY)), product(newZ, newZ)));
+			newX = quotient(newX, lengths);
+			newY = quotient(newY, lengths);
+			newZ = quotient(newZ, lengths);
+		}
+		toArray(newX, fourX);
+		toArray(newY, fourY);
+		toArray(newZ, fourZ);
+	};
+
+	int i = first;
+	for(; i + 4 <= last; i += 4)
+	{
+		transformFourPoints(x + i, y + i, z + i);
+	}
+
+	//The last few points go through the lanes too, padded with unit vectors that are thrown away, so that every
+	//point of a batch is rounded the same way whether or not the compiler contracts the lanes into FMAs
+	if(i < last)
+	{
+		float paddedX[4] = {1, 1, 1, 1};
+		float paddedY[4] = {};
+		float paddedZ[4] = {};
+		std::copy(x + i, x + last, paddedX);
+		std::copy(y + i, y + last, paddedY);
+		std::copy(z + i, z + last, paddedZ);
+		transformFourPoints(paddedX, paddedY, paddedZ);
+		std::copy(paddedX, paddedX + (last - i), x + i);
+		std::copy(paddedY, paddedY + (last - i), y + i);
+		std::copy(paddedZ, paddedZ + (last - i), z + i);
+	}
+}
+
+template<typename RangeTask>
+void BatchTransformKernels::splitBetweenThreads(int numberOfItems, int numberOfThreads, const RangeTask& task)
+{
+	const int usefulNumberOfThreads =
+		std::max(1, std::min(numberOfThreads, numberOfItems / LinearMath::MINIMUM_POINTS_PER_THREAD));
+	//Ranges start on multiples of four, so that only the last one has points left over to pad
+	const int itemsPerThread = ((numberOfItems + usefulNumberOfThreads - 1) / usefulNumberOfThreads + 3) / 4 * 4;
+
+	std::vector<std::thread> workers;
+	for(int i = 1; i < usefulNumberOfThreads; i++)
+	{
+		const int first = i * itemsPerThread;
+		const int last = std::min(numberOfItems, first + itemsPerThread);
+		workers.emplace_back([&task, first, last]() { task(first, last); });
+	}
+	task(0, std::min(numberOfItems, itemsPerThread));
+	for(auto& worker : workers)
+	{
+		worker.join();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+//True while the compiler is evaluating a constant expression, so that constexpr functions can take a path which
+//avoids what can't be evaluated at compile time, such as <cmath> and SIMD intrinsics. Needs GCC 9, Clang 9 or
+//MSVC 2019 16.5 or later.
+#define MATH_TYPES_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+
+//The <cmath> functions the matrix builders need, usable in constant expressions. At run time they are the <cmath>
+//functions themselves. At compile time they are calculated in long double and rounded to the result type, which
+//may differ from <cmath> in the last bit.
+namespace ConstexprMath
+{
+	template<typename Primitive>
+	constexpr Primitive squareRoot(Primitive value);
+
+	template<typename Primitive>
+	constexpr Primitive sine(Primitive angleInRadians);
+
+	template<typename Primitive>
+	constexpr Primitive cosine(Primitive angleInRadians);
+
+	//Used by sine and cosine at compile time. The angle is moved into [-pi, pi], where the Taylor series
+	//converge quickly.
+	constexpr long double reducedAngle(long double angleInRadians);
+	//Sum of the Taylor series that starts at firstTerm and whose terms are -x^2 / ((n + 1)(n + 2)) times the last
+	//one, with n the power of x in it
+	constexpr long double sumOfTaylorSeries(long double x, long double firstTerm, int firstPower);
+}
+
+constexpr long double ConstexprMath::reducedAngle(long double angleInRadians)
+{
+	const long double pi = 3.141592653589793238462643383279502884L;
+	const long double turns = angleInRadians / (2 * pi);
+	long double wholeTurns = static_cast<long double>(static_cast<long long>(turns));
+	if(turns - wholeTurns > 0.5L)
+	{
+		wholeTurns += 1;
+	}
+	else if(turns - wholeTurns < -0.5L)
+	{
+		wholeTurns -= 1;
+	}
+	return angleInRadians - wholeTurns * (2 * pi);
+}
+
+constexpr long double ConstexprMath::sumOfTaylorSeries(long double x, long double firstTerm, int firstPower)
+{
+	long double sum = 0;
+	long double term = firstTerm;
+	for(int power = firstPower; power < 60 && sum + term != sum; power += 2)
+	{
+		sum += term;
+		term *= -1 * x * x / ((power + 1) * (power + 2));
+	}
+	return sum;
+}
+
+template<typename Primitive>
+constexpr Primitive ConstexprMath::squareRoot(Primitive value)
+{
+	if(!MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return std::sqrt(value);
+	}
+	if(value < 0)
+	{
+		return std::numeric_limits<Primitive>::quiet_NaN();
+	}
+	if(value == 0 || value == std::numeric_limits<Primitive>::infinity())
+	{
+		return value;
+	}
+
+	//Newton's method, which approaches the root from above once past the first step and stops when it can't
+	long double root = value < 1 ? 1 : static_cast<long double>(value);
+	for(int i = 0; i < 2000; i++)
+	{
+		const long double nextRoot = (root + value / root) / 2;
+		if(nextRoot >= root)
+		{
+			break;
+		}
+		root = nextRoot;
+	}
+	return static_cast<Primitive>(root);
+}
+
+template<typename Primitive>
+constexpr Primitive ConstexprMath::sine(Primitive angleInRadians)
+{
+	if(!MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return std::sin(angleInRadians);
+	}
+	const long double x = reducedAngle(angleInRadians);
+	return static_cast<Primitive>(sumOfTaylorSeries(x, x, 1));
+}
+
+template<typename Primitive>
+constexpr Primitive ConstexprMath::cosine(Primitive angleInRadians)
+{
+	if(!MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return std::cos(angleInRadians);
+	}
+	const long double x = reducedAngle(angleInRadians);
+	return static_cast<Primitive>(sumOfTaylorSeries(x, 1, 0));
+}
\ No newline at end of file
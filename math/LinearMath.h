@@ -1,201 +1,444 @@
-#pragma once
-
-#include "math/Matrix.h"
-#include "math/Vector.h"
-
-namespace LinearMath
-{
-	template<int dimensions, typename CoordinatePrimitive>
-	CoordinatePrimitive dotProduct(const MathTypes::Vector<dimensions, CoordinatePrimitive>& lhs, 
-		const MathTypes::Vector<dimensions, CoordinatePrimitive>& rhs);
-	
-	template<typename CoordinatePrimitive>
-	MathTypes::Vector<3, CoordinatePrimitive> crossProduct(
-		const MathTypes::Vector<3, CoordinatePrimitive>& lhs, 
-		const MathTypes::Vector<3, CoordinatePrimitive>& rhs);
-
-	template<int dimensions, typename CoordinatePrimitive>
-	CoordinatePrimitive determinant(const MathTypes::Matrix<dimensions, dimensions, CoordinatePrimitive>& matrix);
-
-	template<int dimensions, typename CoordinatePrimitive>
-	MathTypes::Matrix<dimensions, dimensions, CoordinatePrimitive> inverse(
-		const MathTypes::Matrix<dimensions, dimensions, CoordinatePrimitive>& matrix);
-
-	template<int dimensions, typename CoordinatePrimitive>
-	MathTypes::Vector<dimensions, CoordinatePrimitive> linearInterpolation(
-		const MathTypes::Vector<dimensions, CoordinatePrimitive>& lineStart,
-		const MathTypes::Vector<dimensions, CoordinatePrimitive>& lineEnd,		
-		double fractionAlongLineFromStart);
-
-	template<int dimensions, typename CoordinatePrimitive>
-	CoordinatePrimitive distanceBetweenPoints(const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointA,
-		const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointB);
-
-	template<int dimensions, typename CoordinatePrimitive>
-	CoordinatePrimitive distanceBetweenPointsSquared(const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointA,
-		const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointB);
-};
-
-template<typename CoordinatePrimitive>
-CoordinatePrimitive LinearMath::dotProduct(const MathTypes::Vector<2, CoordinatePrimitive>& lhs, 
-	const MathTypes::Vector<2, CoordinatePrimitive>& rhs)
-{
-	const CoordinatePrimitive xProduct = lhs.xValue() * rhs.xValue();
-	const CoordinatePrimitive yProduct = lhs.yValue() * rhs.yValue();
-
-	return xProduct + yProduct;
-}
-
-template<typename CoordinatePrimitive>
-CoordinatePrimitive LinearMath::dotProduct(const MathTypes::Vector<3, CoordinatePrimitive>& lhs, 
-	const MathTypes::Vector<3, CoordinatePrimitive>& rhs)
-{
-	const CoordinatePrimitive xProduct = lhs.xValue() * rhs.xValue();
-	const CoordinatePrimitive yProduct = lhs.yValue() * rhs.yValue();
-	const CoordinatePrimitive zProduct = lhs.zValue() * rhs.zValue();
-
-	return xProduct + yProduct + zProduct;
-}
-
-template<typename CoordinatePrimitive>
-MathTypes::Vector<3, CoordinatePrimitive> LinearMath::crossProduct(
-	const MathTypes::Vector<3, CoordinatePrimitive>& lhs, 
-	const MathTypes::Vector<3, CoordinatePrimitive>& rhs)
-{
-	const CoordinatePrimitive iScalar = (lhs.yValue() * rhs.zValue()) - (lhs.zValue() * rhs.yValue());
-	const CoordinatePrimitive jScalar = (lhs.xValue() * rhs.zValue()) - (lhs.zValue() * rhs.xValue());
-	const CoordinatePrimitive kScalar = (lhs.xValue() * rhs.yValue()) - (lhs.yValue() * rhs.xValue());
-
-	return MathTypes::Vector<3, CoordinatePrimitive>(iScalar, -1*jScalar, kScalar);
-}
-
-template<typename CoordinatePrimitive>
-CoordinatePrimitive LinearMath::determinant(const MathTypes::Matrix<2, 2, CoordinatePrimitive>& matrix)
-{
-	auto& m = matrix;
-
-	return m[0][0]*m[1][1] - m[0][1]*m[1][0];
-}
-
-template<typename CoordinatePrimitive>
-CoordinatePrimitive LinearMath::determinant(const MathTypes::Matrix<3, 3, CoordinatePrimitive>& matrix)
-{
-	auto& m = matrix;
-
-	return m[0][0]*(m[1][1]*m[2][2] - m[1][2]*m[2][1])
-		  - m[0][1]*(m[1][0]*m[2][2] - m[1][2]*m[2][0])
-		  + m[0][2]*(m[1][0]*m[2][1] - m[1][1]*m[2][0]);
-}
-
-template<typename CoordinatePrimitive>
-CoordinatePrimitive LinearMath::determinant(const MathTypes::Matrix<4, 4, CoordinatePrimitive>& matrix)
-{
-	auto det = [](const MathTypes::Matrix<3, 3, CoordinatePrimitive>& matrix)
-	{
-		return LinearMath::determinant(matrix);
-	};
-	using mat = MathTypes::Matrix<3, 3, CoordinatePrimitive>;
-	auto& m = matrix;
-
-	return m[0][0] * det(mat({{m[1][1], m[1][2], m[1][3]}, {m[2][1], m[2][2], m[2][3]}, {m[3][1], m[3][2], m[3][3]}})) 
-		  - m[0][1] * det(mat({{m[1][0], m[1][2], m[1][3]}, {m[2][0], m[2][2], m[2][3]}, {m[3][0], m[3][2], m[3][3]}}))
-		  + m[0][2] * det(mat({{m[1][0], m[1][1], m[1][3]}, {m[2][0], m[2][1], m[2][3]}, {m[3][0], m[3][1], m[3][3]}}))
-		  - m[0][3] * det(mat({{m[1][0], m[1][1], m[1][2]}, {m[2][0], m[2][1], m[2][2]}, {m[3][0], m[3][1], m[3][2]}}));
-}
-
-template<typename CoordinatePrimitive>
-MathTypes::Matrix<2, 2, CoordinatePrimitive> LinearMath::inverse(
-	const MathTypes::Matrix<2, 2, CoordinatePrimitive>& matrix)
-{
-	auto det = LinearMath::determinant(matrix);
-	auto& m = matrix;
-
-	CoordinatePrimitive data[2][2] = 
-	{
-		{m[1][1], -1*m[0][1]}, 
-		{-1*m[1][0], m[0][0]}
-	};
-
-	return MathTypes::Matrix<2, 2, CoordinatePrimitive>((1/det) * data);
-}
-
-template<typename CoordinatePrimitive>
-MathTypes::Matrix<3, 3, CoordinatePrimitive> LinearMath::inverse(
-	const MathTypes::Matrix<3, 3, CoordinatePrimitive>& matrix)
-{
-	auto det = [=](const MathTypes::Matrix<2, 2, CoordinatePrimitive>& matrix)
-	{
-		return LinearMath::determinant(matrix);
-	};
-	using mat = MathTypes::Matrix<2, 2, CoordinatePrimitive>;
-	auto& m = matrix;
-
-	CoordinatePrimitive data[3][3] = 
-	{
-		{det(mat({{m[1][1], m[1][2]}, {m[2][1], m[2][2]}})), -1*det(mat({{m[1][0], m[1][2]}, {m[2][0], m[2][2]}})), det(mat({{m[1][0], m[1][1]}, {m[2][0], m[2][1]}}))},
-		{-1*det(mat({{m[0][1], m[0][2]}, {m[2][1], m[2][2]}})), det(mat({{m[0][0], m[0][2]}, {m[2][0], m[2][2]}})), -1*det(mat({{m[0][0], m[0][1]}, {m[2][0], m[2][1]}}))},
-		{det(mat({{m[0][1], m[0][2]}, {m[1][1], m[1][2]}})), -1*det(mat({{m[0][0], m[0][2]}, {m[1][0], m[1][2]}})), det(mat({{m[0][0], m[0][1]}, {m[1][0], m[1][1]}}))}
-	};
-
-	return (1/LinearMath::determinant(matrix)) * MathTypes::Matrix<3, 3, CoordinatePrimitive>(data).transpose();
-}
-
-template<typename CoordinatePrimitive>
-MathTypes::Matrix<4, 4, CoordinatePrimitive> LinearMath::inverse(
-	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& matrix)
-{
-	auto det = [=](const MathTypes::Matrix<3, 3, CoordinatePrimitive>& matrix)
-	{
-		return LinearMath::determinant(matrix);
-	};
-	using mat = MathTypes::Matrix<3, 3, CoordinatePrimitive>;
-	auto& m = matrix;
-
-	CoordinatePrimitive data[4][4] = 
-	{
-		{det(mat({{m[1][1], m[1][2], m[1][3]}, {m[2][1], m[2][2], m[2][3]}, {m[3][1], m[3][2], m[3][3]}})), 
-			-1*det(mat({{m[1][0], m[1][2], m[1][3]}, {m[2][0], m[2][2], m[2][3]}, {m[3][0], m[3][2], m[3][3]}})), 
-					det(mat({{m[1][0], m[1][1], m[1][3]}, {m[2][0], m[2][1], m[2][3]}, {m[3][0], m[3][1], m[3][3]}})),
-						-1*det(mat({{m[1][0], m[1][1], m[1][2]}, {m[2][0], m[2][1], m[2][2]}, {m[3][0], m[3][1], m[3][2]}}))},
-		{-1*det(mat({{m[0][1], m[0][2], m[0][3]}, {m[2][1], m[2][2], m[2][3]}, {m[3][1], m[3][2], m[3][3]}})), 
-				det(mat({{m[0][0], m[0][2], m[0][3]}, {m[2][0], m[2][2], m[2][3]}, {m[3][0], m[3][2], m[3][3]}})), 
-					-1*det(mat({{m[0][0], m[0][1], m[0][3]}, {m[2][0], m[2][1], m[2][3]}, {m[3][0], m[3][1], m[3][3]}})),
-							det(mat({{m[0][0], m[0][1], m[0][2]}, {m[2][0], m[2][1], m[2][2]}, {m[3][0], m[3][1], m[3][2]}}))},
-		{det(mat({{m[0][1], m[0][2], m[0][3]}, {m[1][1], m[1][2], m[1][3]}, {m[3][1], m[3][2], m[3][3]}})), 
-			-1*det(mat({{m[0][0], m[0][2], m[0][3]}, {m[1][0], m[1][2], m[1][3]}, {m[3][0], m[3][2], m[3][3]}})), 
-					det(mat({{m[0][0], m[0][1], m[0][3]}, {m[1][0], m[1][1], m[1][3]}, {m[3][0], m[3][1], m[3][3]}})),
-				  		-1*det(mat({{m[0][0], m[0][1], m[0][2]}, {m[1][0], m[1][1], m[1][2]}, {m[3][0], m[3][1], m[3][2]}}))},
-		{-1*det(mat({{m[0][1], m[0][2], m[0][3]}, {m[1][1], m[1][2], m[1][3]}, {m[2][1], m[2][2], m[2][3]}})), 
-				det(mat({{m[0][0], m[0][2], m[0][3]}, {m[1][0], m[1][2], m[1][3]}, {m[2][0], m[2][2], m[2][3]}})), 
-					-1*det(mat({{m[0][0], m[0][1], m[0][3]}, {m[1][0], m[1][1], m[1][3]}, {m[2][0], m[2][1], m[2][3]}})),
-							det(mat({{m[0][0], m[0][1], m[0][2]}, {m[1][0], m[1][1], m[1][2]}, {m[2][0], m[2][1], m[2][2]}}))}
-	};
-
-	return (1/LinearMath::determinant(matrix)) * MathTypes::Matrix<4, 4, CoordinatePrimitive>(data).transpose();
-}
-
-template<int dimensions, typename CoordinatePrimitive>
-MathTypes::Vector<dimensions, CoordinatePrimitive> LinearMath::linearInterpolation(
-	const MathTypes::Vector<dimensions, CoordinatePrimitive>& lineStart,
-	const MathTypes::Vector<dimensions, CoordinatePrimitive>& lineEnd,		
-	double fractionAlongLineFromStart)
-{
-	const auto lineSegment = lineEnd - lineStart; 
-   const auto pointOnLine = lineSegment * fractionAlongLineFromStart;
-	return lineStart + pointOnLine;
-}
-
-template<int dimensions, typename CoordinatePrimitive>
-CoordinatePrimitive LinearMath::distanceBetweenPoints(const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointA,
-	const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointB)
-{
-	return (pointB - pointA).magnitude();
-}
-
-template<int dimensions, typename CoordinatePrimitive>
-CoordinatePrimitive LinearMath::distanceBetweenPointsSquared(
-	const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointA,
-	const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointB)
-{
-	return (pointB - pointA).magnitudeSquared();
+#pragma once
+
+#include <array>
+#include <cassert>
+
+#include "math/Matrix.h"
+#include "math/Vector.h"
+
+namespace LinearMath
+{
+	template<int dimensions, typename CoordinatePrimitive>
+	constexpr CoordinatePrimitive dotProduct(const MathTypes::Vector<dimensions, CoordinatePrimitive>& lhs, 
+		const MathTypes::Vector<dimensions, CoordinatePrimitive>& rhs);
+	
+	template<typename CoordinatePrimitive>
+	constexpr MathTypes::Vector<3, CoordinatePrimitive> crossProduct(
+		const MathTypes::Vector<3, CoordinatePrimitive>& lhs, 
+		const MathTypes::Vector<3, CoordinatePrimitive>& rhs);
+
+	//Overloads for the SIMD float specialisation, with the same results as the templates
+	constexpr float dotProduct(const MathTypes::Vector<3, float>& lhs, const MathTypes::Vector<3, float>& rhs);
+	constexpr MathTypes::Vector<3, float> crossProduct(const MathTypes::Vector<3, float>& lhs, const MathTypes::Vector<3, float>& rhs);
+
+	//Opt-in faster normalized, for where speed matters more than the last few bits, such as normals that are only
+	//used for shading. The float overload multiplies by VectorLanes::approximateReciprocalSquareRoot instead of
+	//dividing by the magnitude, so is within 3e-7 of the exact result relative to it, rather than correctly rounded;
+	//the template is normalized itself. Vectors whose squared magnitude is below the smallest normal float, about
+	//1e-38, may be normalized to infinities.
+	//The Vector<4, float> overload normalizes all four components the same way; other four dimensional vectors have
+	//no normalized to fall back on, so have no fastNormalized either.
+	//There is no fast magnitude, as a single square root is already faster than the estimate and its refinement.
+	template<typename CoordinatePrimitive>
+	constexpr MathTypes::Vector<3, CoordinatePrimitive> fastNormalized(const MathTypes::Vector<3, CoordinatePrimitive>& vector);
+	constexpr MathTypes::Vector<3, float> fastNormalized(const MathTypes::Vector<3, float>& vector);
+	constexpr MathTypes::Vector<4, float> fastNormalized(const MathTypes::Vector<4, float>& vector);
+
+	template<int dimensions, typename CoordinatePrimitive>
+	constexpr CoordinatePrimitive determinant(const MathTypes::Matrix<dimensions, dimensions, CoordinatePrimitive>& matrix);
+
+	template<int dimensions, typename CoordinatePrimitive>
+	constexpr MathTypes::Matrix<dimensions, dimensions, CoordinatePrimitive> inverse(
+		const MathTypes::Matrix<dimensions, dimensions, CoordinatePrimitive>& matrix);
+
+	//Inverse of the 3x3 made of the first three entries of each row, by its transposed cofactors. The rows of a 4x4
+	//matrix or an affine transform can be passed directly, to invert their linear part.
+	template<typename CoordinatePrimitive>
+	constexpr MathTypes::Matrix<3, 3, CoordinatePrimitive> inverseOfUpperLeft3x3(
+		const std::array<CoordinatePrimitive, 4>& firstRow,
+		const std::array<CoordinatePrimitive, 4>& secondRow,
+		const std::array<CoordinatePrimitive, 4>& thirdRow);
+
+	//Inverse of a matrix whose bottom row is (0, 0, 0, 1), such as any product of the scale, rotation, translation,
+	//look at, orthographic and viewport matrices. Cheaper than inverse, which this then agrees with.
+	template<typename CoordinatePrimitive>
+	constexpr MathTypes::Matrix<4, 4, CoordinatePrimitive> affineInverse(const MathTypes::Matrix<4, 4, CoordinatePrimitive>& matrix);
+
+	//Inverse of a rotation followed by a translation, such as a product of only rotation, translation and look at
+	//matrices: the rotation is transposed and the translation undone. Any scaling in the matrix makes the result
+	//wrong, so use affineInverse when unsure.
+	template<typename CoordinatePrimitive>
+	constexpr MathTypes::Matrix<4, 4, CoordinatePrimitive> rigidInverse(const MathTypes::Matrix<4, 4, CoordinatePrimitive>& matrix);
+
+	//The point transformed by an affine transformation matrix, as if homogenized with a w of 1, without building
+	//a column matrix for it. The bottom row of the matrix is not used.
+	template<typename CoordinatePrimitive>
+	constexpr MathTypes::Vector<2, CoordinatePrimitive> transformPoint(
+		const MathTypes::Matrix<3, 3, CoordinatePrimitive>& transformation,
+		const MathTypes::Vector<2, CoordinatePrimitive>& point);
+
+	template<typename CoordinatePrimitive>
+	constexpr MathTypes::Vector<3, CoordinatePrimitive> transformPoint(
+		const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformation,
+		const MathTypes::Vector<3, CoordinatePrimitive>& point);
+
+	//As transformPoint, but with a w of 0, so that the translation of the matrix is left out
+	template<typename CoordinatePrimitive>
+	constexpr MathTypes::Vector<3, CoordinatePrimitive> transformDirection(
+		const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformation,
+		const MathTypes::Vector<3, CoordinatePrimitive>& direction);
+
+	template<int dimensions, typename CoordinatePrimitive>
+	constexpr MathTypes::Vector<dimensions, CoordinatePrimitive> linearInterpolation(
+		const MathTypes::Vector<dimensions, CoordinatePrimitive>& lineStart,
+		const MathTypes::Vector<dimensions, CoordinatePrimitive>& lineEnd,		
+		double fractionAlongLineFromStart);
+
+	template<int dimensions, typename CoordinatePrimitive>
+	constexpr CoordinatePrimitive distanceBetweenPoints(const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointA,
+		const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointB);
+
+	template<int dimensions, typename CoordinatePrimitive>
+	constexpr CoordinatePrimitive distanceBetweenPointsSquared(const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointA,
+		const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointB);
+};
+
+template<typename CoordinatePrimitive>
+constexpr CoordinatePrimitive LinearMath::dotProduct(const MathTypes::Vector<2, CoordinatePrimitive>& lhs, 
+	const MathTypes::Vector<2, CoordinatePrimitive>& rhs)
+{
+	const CoordinatePrimitive xProduct = lhs.xValue() * rhs.xValue();
+	const CoordinatePrimitive yProduct = lhs.yValue() * rhs.yValue();
+
+	return xProduct + yProduct;
+}
+
+template<typename CoordinatePrimitive>
+constexpr CoordinatePrimitive LinearMath::dotProduct(const MathTypes::Vector<3, CoordinatePrimitive>& lhs, 
+	const MathTypes::Vector<3, CoordinatePrimitive>& rhs)
+{
+	const CoordinatePrimitive xProduct = lhs.xValue() * rhs.xValue();
+	const CoordinatePrimitive yProduct = lhs.yValue() * rhs.yValue();
+	const CoordinatePrimitive zProduct = lhs.zValue() * rhs.zValue();
+
+	return xProduct + yProduct + zProduct;
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Vector<3, CoordinatePrimitive> LinearMath::crossProduct(
+	const MathTypes::Vector<3, CoordinatePrimitive>& lhs, 
+	const MathTypes::Vector<3, CoordinatePrimitive>& rhs)
+{
+	const CoordinatePrimitive iScalar = (lhs.yValue() * rhs.zValue()) - (lhs.zValue() * rhs.yValue());
+	const CoordinatePrimitive jScalar = (lhs.xValue() * rhs.zValue()) - (lhs.zValue() * rhs.xValue());
+	const CoordinatePrimitive kScalar = (lhs.xValue() * rhs.yValue()) - (lhs.yValue() * rhs.xValue());
+
+	return MathTypes::Vector<3, CoordinatePrimitive>(iScalar, -1*jScalar, kScalar);
+}
+
+constexpr float LinearMath::dotProduct(const MathTypes::Vector<3, float>& lhs, const MathTypes::Vector<3, float>& rhs)
+{
+	return MathTypes::VectorLanes::dotProductOfFirstThree(lhs.lanes(), rhs.lanes());
+}
+
+constexpr MathTypes::Vector<3, float> LinearMath::crossProduct(
+	const MathTypes::Vector<3, float>& lhs, 
+	const MathTypes::Vector<3, float>& rhs)
+{
+	return MathTypes::Vector<3, float>(MathTypes::VectorLanes::crossProductOfFirstThree(lhs.lanes(), rhs.lanes()));
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Vector<3, CoordinatePrimitive> LinearMath::fastNormalized(
+	const MathTypes::Vector<3, CoordinatePrimitive>& vector)
+{
+	return vector.normalized();
+}
+
+constexpr MathTypes::Vector<3, float> LinearMath::fastNormalized(const MathTypes::Vector<3, float>& vector)
+{
+	using namespace MathTypes::VectorLanes;
+	const Lanes normalizingScalars = approximateReciprocalSquareRoot(broadcast(vector.magnitudeSquared()));
+	return MathTypes::Vector<3, float>(product(vector.lanes(), normalizingScalars));
+}
+
+constexpr MathTypes::Vector<4, float> LinearMath::fastNormalized(const MathTypes::Vector<4, float>& vector)
+{
+	using namespace MathTypes::VectorLanes;
+	const float x = vector.xValue();
+	const float y = vector.yValue();
+	const float z = vector.zValue();
+	const float w = vector.wValue();
+	const Lanes normalizingScalars = approximateReciprocalSquareRoot(broadcast(x*x + y*y + z*z + w*w));
+	return MathTypes::Vector<4, float>(product(vector.lanes(), normalizingScalars));
+}
+
+template<typename CoordinatePrimitive>
+constexpr CoordinatePrimitive LinearMath::determinant(const MathTypes::Matrix<2, 2, CoordinatePrimitive>& matrix)
+{
+	auto& m = matrix;
+
+	return m[0][0]*m[1][1] - m[0][1]*m[1][0];
+}
+
+template<typename CoordinatePrimitive>
+constexpr CoordinatePrimitive LinearMath::determinant(const MathTypes::Matrix<3, 3, CoordinatePrimitive>& matrix)
+{
+	auto& m = matrix;
+
+	return m[0][0]*(m[1][1]*m[2][2] - m[1][2]*m[2][1])
+		  - m[0][1]*(m[1][0]*m[2][2] - m[1][2]*m[2][0])
+		  + m[0][2]*(m[1][0]*m[2][1] - m[1][1]*m[2][0]);
+}
+
+template<typename CoordinatePrimitive>
+constexpr CoordinatePrimitive LinearMath::determinant(const MathTypes::Matrix<4, 4, CoordinatePrimitive>& matrix)
+{
+	auto det = [](const MathTypes::Matrix<3, 3, CoordinatePrimitive>& matrix)
+	{
+		return LinearMath::determinant(matrix);
+	};
+	using mat = MathTypes::Matrix<3, 3, CoordinatePrimitive>;
+	auto& m = matrix;
+
+	return m[0][0] * det(mat({{m[1][1], m[1][2], m[1][3]}, {m[2][1], m[2][2], m[2][3]}, {m[3][1], m[3][2], m[3][3]}})) 
+		  - m[0][1] * det(mat({{m[1][0], m[1][2], m[1][3]}, {m[2][0], m[2][2], m[2][3]}, {m[3][0], m[3][2], m[3][3]}}))
+		  + m[0][2] * det(mat({{m[1][0], m[1][1], m[1][3]}, {m[2][0], m[2][1], m[2][3]}, {m[3][0], m[3][1], m[3][3]}}))
+		  - m[0][3] * det(mat({{m[1][0], m[1][1], m[1][2]}, {m[2][0], m[2][1], m[2][2]}, {m[3][0], m[3][1], m[3][2]}}));
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Matrix<2, 2, CoordinatePrimitive> LinearMath::inverse(
+	const MathTypes::Matrix<2, 2, CoordinatePrimitive>& matrix)
+{
+	auto det = LinearMath::determinant(matrix);
+	auto& m = matrix;
+
+	CoordinatePrimitive data[2][2] = 
+	{
+		{m[1][1], -1*m[0][1]}, 
+		{-1*m[1][0], m[0][0]}
+	};
+
+	return (1/det) * MathTypes::Matrix<2, 2, CoordinatePrimitive>(data);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Matrix<3, 3, CoordinatePrimitive> LinearMath::inverse(
+	const MathTypes::Matrix<3, 3, CoordinatePrimitive>& matrix)
+{
+	auto det = [=](const MathTypes::Matrix<2, 2, CoordinatePrimitive>& matrix)
+	{
+		return LinearMath::determinant(matrix);
+	};
+	using mat = MathTypes::Matrix<2, 2, CoordinatePrimitive>;
+	auto& m = matrix;
+
+	CoordinatePrimitive data[3][3] = 
+	{
+		{det(mat({{m[1][1], m[1][2]}, {m[2][1], m[2][2]}})), -1*det(mat({{m[1][0], m[1][2]}, {m[2][0], m[2][2]}})), det(mat({{m[1][0], m[1][1]}, {m[2][0], m[2][1]}}))},
+		{-1*det(mat({{m[0][1], m[0][2]}, {m[2][1], m[2][2]}})), det(mat({{m[0][0], m[0][2]}, {m[2][0], m[2][2]}})), -1*det(mat({{m[0][0], m[0][1]}, {m[2][0], m[2][1]}}))},
+		{det(mat({{m[0][1], m[0][2]}, {m[1][1], m[1][2]}})), -1*det(mat({{m[0][0], m[0][2]}, {m[1][0], m[1][2]}})), det(mat({{m[0][0], m[0][1]}, {m[1][0], m[1][1]}}))}
+	};
+
+	return (1/LinearMath::determinant(matrix)) * MathTypes::Matrix<3, 3, CoordinatePrimitive>(data).transpose();
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Matrix<4, 4, CoordinatePrimitive> LinearMath::inverse(
+	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& matrix)
+{
+	using T = CoordinatePrimitive;
+	const auto& m = matrix;
+
+	//Every 3x3 cofactor expands into the 2x2 minors of either the top two or the bottom two rows, so those twelve
+	//minors are calculated once and shared. topMinorIJ uses columns I and J of rows 0 and 1, bottomMinorIJ those
+	//of rows 2 and 3.
+	const T topMinor01 = m[0][0]*m[1][1] - m[0][1]*m[1][0];
+	const T topMinor02 = m[0][0]*m[1][2] - m[0][2]*m[1][0];
+	const T topMinor03 = m[0][0]*m[1][3] - m[0][3]*m[1][0];
+	const T topMinor12 = m[0][1]*m[1][2] - m[0][2]*m[1][1];
+	const T topMinor13 = m[0][1]*m[1][3] - m[0][3]*m[1][1];
+	const T topMinor23 = m[0][2]*m[1][3] - m[0][3]*m[1][2];
+	const T bottomMinor01 = m[2][0]*m[3][1] - m[2][1]*m[3][0];
+	const T bottomMinor02 = m[2][0]*m[3][2] - m[2][2]*m[3][0];
+	const T bottomMinor03 = m[2][0]*m[3][3] - m[2][3]*m[3][0];
+	const T bottomMinor12 = m[2][1]*m[3][2] - m[2][2]*m[3][1];
+	const T bottomMinor13 = m[2][1]*m[3][3] - m[2][3]*m[3][1];
+	const T bottomMinor23 = m[2][2]*m[3][3] - m[2][3]*m[3][2];
+
+	const T determinant = topMinor01*bottomMinor23 - topMinor02*bottomMinor13 + topMinor03*bottomMinor12
+		+ topMinor12*bottomMinor03 - topMinor13*bottomMinor02 + topMinor23*bottomMinor01;
+	const T inverseOfDeterminant = 1/determinant;
+
+	//The transposed cofactors, divided by the determinant
+	std::array<std::array<T, 4>, 4> data = {{
+		{
+			(m[1][1]*bottomMinor23 - m[1][2]*bottomMinor13 + m[1][3]*bottomMinor12) * inverseOfDeterminant,
+			(-1*m[0][1]*bottomMinor23 + m[0][2]*bottomMinor13 - m[0][3]*bottomMinor12) * inverseOfDeterminant,
+			(m[3][1]*topMinor23 - m[3][2]*topMinor13 + m[3][3]*topMinor12) * inverseOfDeterminant,
+			(-1*m[2][1]*topMinor23 + m[2][2]*topMinor13 - m[2][3]*topMinor12) * inverseOfDeterminant
+		},
+		{
+			(-1*m[1][0]*bottomMinor23 + m[1][2]*bottomMinor03 - m[1][3]*bottomMinor02) * inverseOfDeterminant,
+			(m[0][0]*bottomMinor23 - m[0][2]*bottomMinor03 + m[0][3]*bottomMinor02) * inverseOfDeterminant,
+			(-1*m[3][0]*topMinor23 + m[3][2]*topMinor03 - m[3][3]*topMinor02) * inverseOfDeterminant,
+			(m[2][0]*topMinor23 - m[2][2]*topMinor03 + m[2][3]*topMinor02) * inverseOfDeterminant
+		},
+		{
+			(m[1][0]*bottomMinor13 - m[1][1]*bottomMinor03 + m[1][3]*bottomMinor01) * inverseOfDeterminant,
+			(-1*m[0][0]*bottomMinor13 + m[0][1]*bottomMinor03 - m[0][3]*bottomMinor01) * inverseOfDeterminant,
+			(m[3][0]*topMinor13 - m[3][1]*topMinor03 + m[3][3]*topMinor01) * inverseOfDeterminant,
+			(-1*m[2][0]*topMinor13 + m[2][1]*topMinor03 - m[2][3]*topMinor01) * inverseOfDeterminant
+		},
+		{
+			(-1*m[1][0]*bottomMinor12 + m[1][1]*bottomMinor02 - m[1][2]*bottomMinor01) * inverseOfDeterminant,
+			(m[0][0]*bottomMinor12 - m[0][1]*bottomMinor02 + m[0][2]*bottomMinor01) * inverseOfDeterminant,
+			(-1*m[3][0]*topMinor12 + m[3][1]*topMinor02 - m[3][2]*topMinor01) * inverseOfDeterminant,
+			(m[2][0]*topMinor12 - m[2][1]*topMinor02 + m[2][2]*topMinor01) * inverseOfDeterminant
+		}
+	}};
+
+	return MathTypes::Matrix<4, 4, CoordinatePrimitive>(data);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Matrix<3, 3, CoordinatePrimitive> LinearMath::inverseOfUpperLeft3x3(
+	const std::array<CoordinatePrimitive, 4>& firstRow,
+	const std::array<CoordinatePrimitive, 4>& secondRow,
+	const std::array<CoordinatePrimitive, 4>& thirdRow)
+{
+	using T = CoordinatePrimitive;
+	const std::array<CoordinatePrimitive, 4> m[3] = {firstRow, secondRow, thirdRow};
+
+	const T cofactor00 = m[1][1]*m[2][2] - m[1][2]*m[2][1];
+	const T cofactor01 = m[1][2]*m[2][0] - m[1][0]*m[2][2];
+	const T cofactor02 = m[1][0]*m[2][1] - m[1][1]*m[2][0];
+	const T inverseOfDeterminant = 1/(m[0][0]*cofactor00 + m[0][1]*cofactor01 + m[0][2]*cofactor02);
+
+	return MathTypes::Matrix<3, 3, CoordinatePrimitive>(std::array<std::array<T, 3>, 3>{{
+		{
+			cofactor00 * inverseOfDeterminant,
+			(m[0][2]*m[2][1] - m[0][1]*m[2][2]) * inverseOfDeterminant,
+			(m[0][1]*m[1][2] - m[0][2]*m[1][1]) * inverseOfDeterminant
+		},
+		{
+			cofactor01 * inverseOfDeterminant,
+			(m[0][0]*m[2][2] - m[0][2]*m[2][0]) * inverseOfDeterminant,
+			(m[0][2]*m[1][0] - m[0][0]*m[1][2]) * inverseOfDeterminant
+		},
+		{
+			cofactor02 * inverseOfDeterminant,
+			(m[0][1]*m[2][0] - m[0][0]*m[2][1]) * inverseOfDeterminant,
+			(m[0][0]*m[1][1] - m[0][1]*m[1][0]) * inverseOfDeterminant
+		}
+	}});
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Matrix<4, 4, CoordinatePrimitive> LinearMath::affineInverse(
+	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& matrix)
+{
+	using T = CoordinatePrimitive;
+	const auto& m = matrix;
+	assert(m[3][0] == 0 && m[3][1] == 0 && m[3][2] == 0 && m[3][3] == 1);
+
+	//The upper left 3x3 is inverted on its own
+	const auto inverseOfLinearPart = inverseOfUpperLeft3x3(m[0], m[1], m[2]);
+
+	//Then the translation is undone after the inverted linear part, rather than before the original one
+	std::array<std::array<T, 4>, 4> data = {};
+	for(int i = 0; i < 3; i++)
+	{
+		const auto& row = inverseOfLinearPart[i];
+		data[i] = {row[0], row[1], row[2], -1*(row[0]*m[0][3] + row[1]*m[1][3] + row[2]*m[2][3])};
+	}
+	data[3] = {0, 0, 0, 1};
+
+	return MathTypes::Matrix<4, 4, CoordinatePrimitive>(data);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Matrix<4, 4, CoordinatePrimitive> LinearMath::rigidInverse(
+	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& matrix)
+{
+	const auto& m = matrix;
+	assert(m[3][0] == 0 && m[3][1] == 0 && m[3][2] == 0 && m[3][3] == 1);
+
+	//The inverse of a rotation is its transpose
+	std::array<std::array<CoordinatePrimitive, 4>, 4> data = {};
+	for(int i = 0; i < 3; i++)
+	{
+		data[i] = {m[0][i], m[1][i], m[2][i], -1*(m[0][i]*m[0][3] + m[1][i]*m[1][3] + m[2][i]*m[2][3])};
+	}
+	data[3] = {0, 0, 0, 1};
+
+	return MathTypes::Matrix<4, 4, CoordinatePrimitive>(data);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Vector<2, CoordinatePrimitive> LinearMath::transformPoint(
+	const MathTypes::Matrix<3, 3, CoordinatePrimitive>& transformation,
+	const MathTypes::Vector<2, CoordinatePrimitive>& point)
+{
+	const CoordinatePrimitive x = point.xValue();
+	const CoordinatePrimitive y = point.yValue();
+	const auto& firstRow = transformation[0];
+	const auto& secondRow = transformation[1];
+
+	return MathTypes::Vector<2, CoordinatePrimitive>(
+		firstRow[0]*x + firstRow[1]*y + firstRow[2],
+		secondRow[0]*x + secondRow[1]*y + secondRow[2]);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Vector<3, CoordinatePrimitive> LinearMath::transformPoint(
+	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformation,
+	const MathTypes::Vector<3, CoordinatePrimitive>& point)
+{
+	const CoordinatePrimitive x = point.xValue();
+	const CoordinatePrimitive y = point.yValue();
+	const CoordinatePrimitive z = point.zValue();
+	const auto& firstRow = transformation[0];
+	const auto& secondRow = transformation[1];
+	const auto& thirdRow = transformation[2];
+
+	return MathTypes::Vector<3, CoordinatePrimitive>(
+		firstRow[0]*x + firstRow[1]*y + firstRow[2]*z + firstRow[3],
+		secondRow[0]*x + secondRow[1]*y + secondRow[2]*z + secondRow[3],
+		thirdRow[0]*x + thirdRow[1]*y + thirdRow[2]*z + thirdRow[3]);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Vector<3, CoordinatePrimitive> LinearMath::transformDirection(
+	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformation,
+	const MathTypes::Vector<3, CoordinatePrimitive>& direction)
+{
+	const CoordinatePrimitive x = direction.xValue();
+	const CoordinatePrimitive y = direction.yValue();
+	const CoordinatePrimitive z = direction.zValue();
+	const auto& firstRow = transformation[0];
+	const auto& secondRow = transformation[1];
+	const auto& thirdRow = transformation[2];
+
+	return MathTypes::Vector<3, CoordinatePrimitive>(
+		firstRow[0]*x + firstRow[1]*y + firstRow[2]*z,
+		secondRow[0]*x + secondRow[1]*y + secondRow[2]*z,
+		thirdRow[0]*x + thirdRow[1]*y + thirdRow[2]*z);
+}
+
+template<int dimensions, typename CoordinatePrimitive>
+constexpr MathTypes::Vector<dimensions, CoordinatePrimitive> LinearMath::linearInterpolation(
+	const MathTypes::Vector<dimensions, CoordinatePrimitive>& lineStart,
+	const MathTypes::Vector<dimensions, CoordinatePrimitive>& lineEnd,		
+	double fractionAlongLineFromStart)
+{
+	const auto lineSegment = lineEnd - lineStart; 
+   const auto pointOnLine = lineSegment * fractionAlongLineFromStart;
+	return lineStart + pointOnLine;
+}
+
+template<int dimensions, typename CoordinatePrimitive>
+constexpr CoordinatePrimitive LinearMath::distanceBetweenPoints(const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointA,
+	const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointB)
+{
+	return (pointB - pointA).magnitude();
+}
+
+template<int dimensions, typename CoordinatePrimitive>
+constexpr CoordinatePrimitive LinearMath::distanceBetweenPointsSquared(
+	const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointA,
+	const MathTypes::Vector<dimensions, CoordinatePrimitive>& pointB)
+{
+	return (pointB - pointA).magnitudeSquared();
 }
\ No newline at end of file
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "math/Matrix.h"
+#include "math/Vector.h"
+
+//Opt-in lazy evaluation of products of 4x4 matrices. MatrixExpressions::lazy(a) * b * c builds an expression
+//that refers to a, b and c rather than multiplying them. When the expression is multiplied by a vector, the vector
+//is multiplied by each matrix from the right, so a chain of n matrices costs n matrix-vector products instead of
+//n - 1 matrix products. Evaluating it multiplies the matrices from the left, the same work as the eager product.
+//Only 4x4 matrices have a matrix-vector product, so only they can be made lazy.
+//Expressions only refer to their matrices, so an expression containing a temporary matrix must be used within the
+//statement that builds it.
+namespace MatrixExpressions
+{
+	//Base of every expression, so that the operators below only match expressions
+	template<typename Expression>
+	class MatrixExpression
+	{
+	public:
+		constexpr const Expression& expression() const;
+	};
+
+	template<typename CoordinatePrimitive>
+	class MatrixReference : public MatrixExpression<MatrixReference<CoordinatePrimitive>>
+	{
+	public:
+		using MatrixType = MathTypes::Matrix<4, 4, CoordinatePrimitive>;
+		using VectorType = MathTypes::Vector<4, CoordinatePrimitive>;
+
+		constexpr explicit MatrixReference(const MatrixType& matrix);
+
+		constexpr MatrixType evaluate() const;
+		constexpr void multiplyOnTheRightOf(MatrixType& product) const;
+		constexpr VectorType timesVector(const VectorType& vector) const;
+
+	private:
+		const MatrixType& matrix_;
+	};
+
+	template<typename LhsExpression, typename RhsExpression>
+	class Product : public MatrixExpression<Product<LhsExpression, RhsExpression>>
+	{
+	public:
+		using MatrixType = typename LhsExpression::MatrixType;
+		using VectorType = typename LhsExpression::VectorType;
+
+		constexpr Product(const LhsExpression& lhs, const RhsExpression& rhs);
+
+		constexpr MatrixType evaluate() const;
+		constexpr void multiplyOnTheRightOf(MatrixType& product) const;
+		constexpr VectorType timesVector(const VectorType& vector) const;
+
+	private:
+		LhsExpression lhs_;
+		RhsExpression rhs_;
+	};
+
+	template<typename CoordinatePrimitive>
+	constexpr MatrixReference<CoordinatePrimitive> lazy(
+		const MathTypes::Matrix<4, 4, CoordinatePrimitive>& matrix);
+}
+
+template<typename LhsExpression, typename RhsExpression>
+constexpr MatrixExpressions::Product<LhsExpression, RhsExpression> operator*(
+	const MatrixExpressions::MatrixExpression<LhsExpression>& lhs,
+	const MatrixExpressions::MatrixExpression<RhsExpression>& rhs);
+
+template<typename LhsExpression, typename CoordinatePrimitive>
+constexpr MatrixExpressions::Product<LhsExpression, MatrixExpressions::MatrixReference<CoordinatePrimitive>>
+operator*(
+	const MatrixExpressions::MatrixExpression<LhsExpression>& lhs,
+	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& rhs);
+
+//The whole chain applied to the vector as a column, one matrix at a time from the right
+template<typename LhsExpression, typename CoordinatePrimitive>
+constexpr MathTypes::Vector<4, CoordinatePrimitive> operator*(
+	const MatrixExpressions::MatrixExpression<LhsExpression>& lhs,
+	const MathTypes::Vector<4, CoordinatePrimitive>& rhs);
+
+template<typename Expression>
+constexpr const Expression& MatrixExpressions::MatrixExpression<Expression>::expression() const
+{
+	return static_cast<const Expression&>(*this);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MatrixExpressions::MatrixReference<CoordinatePrimitive>::MatrixReference(const MatrixType& matrix)
+	: matrix_(matrix)
+{
+}
+
+template<typename CoordinatePrimitive>
+constexpr typename MatrixExpressions::MatrixReference<CoordinatePrimitive>::MatrixType
+MatrixExpressions::MatrixReference<CoordinatePrimitive>::evaluate() const
+{
+	return matrix_;
+}
+
+template<typename CoordinatePrimitive>
+constexpr void MatrixExpressions::MatrixReference<CoordinatePrimitive>::multiplyOnTheRightOf(
+	MatrixType& product) const
+{
+	product = product * matrix_;
+}
+
+template<typename CoordinatePrimitive>
+constexpr typename MatrixExpressions::MatrixReference<CoordinatePrimitive>::VectorType
+MatrixExpressions::MatrixReference<CoordinatePrimitive>::timesVector(const VectorType& vector) const
+{
+	return matrix_ * vector;
+}
+
+template<typename LhsExpression, typename RhsExpression>
+constexpr MatrixExpressions::Product<LhsExpression, RhsExpression>::Product(
+	const LhsExpression& lhs,
+	const RhsExpression& rhs)
+	: lhs_(lhs)
+	, rhs_(rhs)
+{
+}
+
+template<typename LhsExpression, typename RhsExpression>
+constexpr typename MatrixExpressions::Product<LhsExpression, RhsExpression>::MatrixType
+MatrixExpressions::Product<LhsExpression, RhsExpression>::evaluate() const
+{
+	auto product = lhs_.evaluate();
+	rhs_.multiplyOnTheRightOf(product);
+
+	return product;
+}
+
+template<typename LhsExpression, typename RhsExpression>
+constexpr void MatrixExpressions::Product<LhsExpression, RhsExpression>::multiplyOnTheRightOf(
+	MatrixType& product) const
+{
+	lhs_.multiplyOnTheRightOf(product);
+	rhs_.multiplyOnTheRightOf(product);
+}
+
+template<typename LhsExpression, typename RhsExpression>
+constexpr typename MatrixExpressions::Product<LhsExpression, RhsExpression>::VectorType
+MatrixExpressions::Product<LhsExpression, RhsExpression>::timesVector(const VectorType& vector) const
+{
+	return lhs_.timesVector(rhs_.timesVector(vector));
+}
+
+template<typename CoordinatePrimitive>
+constexpr MatrixExpressions::MatrixReference<CoordinatePrimitive> MatrixExpressions::lazy(
+	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& matrix)
+{
+	return MatrixReference<CoordinatePrimitive>(matrix);
+}
+
+template<typename LhsExpression, typename RhsExpression>
+constexpr MatrixExpressions::Product<LhsExpression, RhsExpression> operator*(
+	const MatrixExpressions::MatrixExpression<LhsExpression>& lhs,
+	const MatrixExpressions::MatrixExpression<RhsExpression>& rhs)
+{
+	return MatrixExpressions::Product<LhsExpression, RhsExpression>(lhs.expression(), rhs.expression());
+}
+
+template<typename LhsExpression, typename CoordinatePrimitive>
+constexpr MatrixExpressions::Product<LhsExpression, MatrixExpressions::MatrixReference<CoordinatePrimitive>>
+operator*(
+	const MatrixExpressions::MatrixExpression<LhsExpression>& lhs,
+	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& rhs)
+{
+	return lhs * MatrixExpressions::lazy(rhs);
+}
+
+template<typename LhsExpression, typename CoordinatePrimitive>
+constexpr MathTypes::Vector<4, CoordinatePrimitive> operator*(
+	const MatrixExpressions::MatrixExpression<LhsExpression>& lhs,
+	const MathTypes::Vector<4, CoordinatePrimitive>& rhs)
+{
+	return lhs.expression().timesVector(rhs);
+}
\ No newline at end of file
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <typeinfo>
+
+#include "math/ConstexprMath.h"
+#include "math/Matrix.h"
+#include "math/Trigonometry.h"
+#include "math/Vector.h"
+
+namespace MathTypes
+{
+	//A rotation stored as the unit quaternion w + xi + yj + zk. Composing rotations costs 16 multiplications
+	//instead of the 64 of a 4x4 matrix product, and a quaternion that drifts away from unit length through rounding
+	//is put back by normalized, while a rotation matrix that drifts stops being orthonormal and starts to shear.
+	template<typename CoordinatePrimitive>
+	class Quaternion
+	{
+	public:
+		constexpr Quaternion(CoordinatePrimitive w, CoordinatePrimitive x, CoordinatePrimitive y, CoordinatePrimitive z);
+
+		static constexpr Quaternion<CoordinatePrimitive> identity();
+		//The same rotation as Matrices::rotateAboutLine for the same axis and angle
+		static constexpr Quaternion<CoordinatePrimitive> fromAxisAndAngle(
+			const Vector<3, CoordinatePrimitive>& axis, CoordinatePrimitive angleInDegrees);
+
+		constexpr CoordinatePrimitive wValue() const;
+		constexpr CoordinatePrimitive xValue() const;
+		constexpr CoordinatePrimitive yValue() const;
+		constexpr CoordinatePrimitive zValue() const;
+
+		constexpr CoordinatePrimitive magnitude() const;
+		constexpr CoordinatePrimitive magnitudeSquared() const;
+		constexpr Quaternion<CoordinatePrimitive> normalized() const;
+		//The inverse rotation, for a unit quaternion
+		constexpr Quaternion<CoordinatePrimitive> conjugate() const;
+		constexpr Vector<3, CoordinatePrimitive> rotated(const Vector<3, CoordinatePrimitive>& vector) const;
+		//The rotation matrix, which is only a rotation if the quaternion is of unit length
+		constexpr explicit operator Matrix<4, 4, CoordinatePrimitive>() const;
+
+		std::string toString() const;
+
+	private:
+		CoordinatePrimitive w_;
+		CoordinatePrimitive x_;
+		CoordinatePrimitive y_;
+		CoordinatePrimitive z_;
+	};
+}
+
+//The rotation rhs followed by the rotation lhs, like the product of their matrices
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Quaternion<CoordinatePrimitive> operator*(
+	const MathTypes::Quaternion<CoordinatePrimitive>& lhs,
+	const MathTypes::Quaternion<CoordinatePrimitive>& rhs);
+
+template<typename CoordinatePrimitive>
+constexpr bool operator==(
+	const MathTypes::Quaternion<CoordinatePrimitive>& lhs,
+	const MathTypes::Quaternion<CoordinatePrimitive>& rhs);
+
+namespace LinearMath
+{
+	//The rotation fractionFromStart of the way from start to end, turning at a constant rate along the shorter way
+	//around. Both quaternions should be of unit length.
+	template<typename CoordinatePrimitive>
+	MathTypes::Quaternion<CoordinatePrimitive> sphericalLinearInterpolation(
+		const MathTypes::Quaternion<CoordinatePrimitive>& start,
+		const MathTypes::Quaternion<CoordinatePrimitive>& end,
+		double fractionFromStart);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Quaternion<CoordinatePrimitive>::Quaternion(
+	CoordinatePrimitive w,
+	CoordinatePrimitive x,
+	CoordinatePrimitive y,
+	CoordinatePrimitive z)
+	: w_(w), x_(x), y_(y), z_(z)
+{
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Quaternion<CoordinatePrimitive> MathTypes::Quaternion<CoordinatePrimitive>::identity()
+{
+	return Quaternion<CoordinatePrimitive>(1, 0, 0, 0);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Quaternion<CoordinatePrimitive> MathTypes::Quaternion<CoordinatePrimitive>::fromAxisAndAngle(
+	const Vector<3, CoordinatePrimitive>& axis, CoordinatePrimitive angleInDegrees)
+{
+	const auto normalizedAxis = axis.normalized();
+	const CoordinatePrimitive halfAngleInRadians = Trigonometry::convertAngleFromDegreesToRadians(angleInDegrees) / 2;
+	const CoordinatePrimitive sineOfHalfAngle = ConstexprMath::sine(halfAngleInRadians);
+
+	return Quaternion<CoordinatePrimitive>(
+		ConstexprMath::cosine(halfAngleInRadians),
+		normalizedAxis.xValue() * sineOfHalfAngle,
+		normalizedAxis.yValue() * sineOfHalfAngle,
+		normalizedAxis.zValue() * sineOfHalfAngle);
+}
+
+template<typename CoordinatePrimitive>
+constexpr CoordinatePrimitive MathTypes::Quaternion<CoordinatePrimitive>::wValue() const
+{
+	return w_;
+}
+
+template<typename CoordinatePrimitive>
+constexpr CoordinatePrimitive MathTypes::Quaternion<CoordinatePrimitive>::xValue() const
+{
+	return x_;
+}
+
+template<typename CoordinatePrimitive>
+constexpr CoordinatePrimitive MathTypes::Quaternion<CoordinatePrimitive>::yValue() const
+{
+	return y_;
+}
+
+template<typename CoordinatePrimitive>
+constexpr CoordinatePrimitive MathTypes::Quaternion<CoordinatePrimitive>::zValue() const
+{
+	return z_;
+}
+
+template<typename CoordinatePrimitive>
+constexpr CoordinatePrimitive MathTypes::Quaternion<CoordinatePrimitive>::magnitude() const
+{
+	return ConstexprMath::squareRoot(magnitudeSquared());
+}
+
+template<typename CoordinatePrimitive>
+constexpr CoordinatePrimitive MathTypes::Quaternion<CoordinatePrimitive>::magnitudeSquared() const
+{
+	return (w_ * w_) + (x_ * x_) + (y_ * y_) + (z_ * z_);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Quaternion<CoordinatePrimitive> MathTypes::Quaternion<CoordinatePrimitive>::normalized() const
+{
+	const CoordinatePrimitive normalizingScalar = 1.0 / this->magnitude();
+	return Quaternion<CoordinatePrimitive>(
+		w_ * normalizingScalar, x_ * normalizingScalar, y_ * normalizingScalar, z_ * normalizingScalar);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Quaternion<CoordinatePrimitive> MathTypes::Quaternion<CoordinatePrimitive>::conjugate() const
+{
+	return Quaternion<CoordinatePrimitive>(w_, -1*x_, -1*y_, -1*z_);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Vector<3, CoordinatePrimitive> MathTypes::Quaternion<CoordinatePrimitive>::rotated(
+	const Vector<3, CoordinatePrimitive>& vector) const
+{
+	const auto rotatedAsQuaternion =
+		*this * Quaternion<CoordinatePrimitive>(0, vector.xValue(), vector.yValue(), vector.zValue()) * conjugate();
+
+	return Vector<3, CoordinatePrimitive>(
+		rotatedAsQuaternion.xValue(), rotatedAsQuaternion.yValue(), rotatedAsQuaternion.zValue());
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Quaternion<CoordinatePrimitive>::operator Matrix<4, 4, CoordinatePrimitive>() const
+{
+	const CoordinatePrimitive w = w_;
+	const CoordinatePrimitive x = x_;
+	const CoordinatePrimitive y = y_;
+	const CoordinatePrimitive z = z_;
+
+	return Matrix<4, 4, CoordinatePrimitive>({
+		{1 - 2*(y*y + z*z), 2*(x*y - w*z),     2*(x*z + w*y),     0},
+		{2*(x*y + w*z),     1 - 2*(x*x + z*z), 2*(y*z - w*x),     0},
+		{2*(x*z - w*y),     2*(y*z + w*x),     1 - 2*(x*x + y*y), 0},
+		{0,                 0,                 0,                 1}
+	});
+}
+
+template<typename CoordinatePrimitive>
+std::string MathTypes::Quaternion<CoordinatePrimitive>::toString() const
+{
+	const char* formatString = "Quaternion. (%.3f, %.3f, %.3f, %.3f). Coordinate Type: %s";
+	char buffer[100];
+
+	sprintf(buffer, formatString, w_, x_, y_, z_, typeid(CoordinatePrimitive).name());
+
+	return std::string(buffer);
+}
+
+template<typename CoordinatePrimitive>
+constexpr MathTypes::Quaternion<CoordinatePrimitive> operator*(
+	const MathTypes::Quaternion<CoordinatePrimitive>& lhs,
+	const MathTypes::Quaternion<CoordinatePrimitive>& rhs)
+{
+	const auto& a = lhs;
+	const auto& b = rhs;
+
+	return MathTypes::Quaternion<CoordinatePrimitive>(
+		a.wValue()*b.wValue() - a.xValue()*b.xValue() - a.yValue()*b.yValue() - a.zValue()*b.zValue(),
+		a.wValue()*b.xValue() + a.xValue()*b.wValue() + a.yValue()*b.zValue() - a.zValue()*b.yValue(),
+		a.wValue()*b.yValue() - a.xValue()*b.zValue() + a.yValue()*b.wValue() + a.zValue()*b.xValue(),
+		a.wValue()*b.zValue() + a.xValue()*b.yValue() - a.yValue()*b.xValue() + a.zValue()*b.wValue());
+}
+
+template<typename CoordinatePrimitive>
+constexpr bool operator==(
+	const MathTypes::Quaternion<CoordinatePrimitive>& lhs,
+	const MathTypes::Quaternion<CoordinatePrimitive>& rhs)
+{
+	return (lhs.wValue() == rhs.wValue()) && (lhs.xValue() == rhs.xValue()) && (lhs.yValue() == rhs.yValue())
+		&& (lhs.zValue() == rhs.zValue());
+}
+
+template<typename CoordinatePrimitive>
+MathTypes::Quaternion<CoordinatePrimitive> LinearMath::sphericalLinearInterpolation(
+	const MathTypes::Quaternion<CoordinatePrimitive>& start,
+	const MathTypes::Quaternion<CoordinatePrimitive>& end,
+	double fractionFromStart)
+{
+	using Quaternion = MathTypes::Quaternion<CoordinatePrimitive>;
+	double cosineOfAngle = start.wValue()*end.wValue() + start.xValue()*end.xValue() + start.yValue()*end.yValue()
+		+ start.zValue()*end.zValue();
+	//q and -q are the same rotation, so the one closer to start is the shorter way around
+	const double endSign = cosineOfAngle < 0 ? -1 : 1;
+	cosineOfAngle *= endSign;
+
+	double startWeight = 1 - fractionFromStart;
+	double endWeight = fractionFromStart;
+	//Close enough that the sine below loses its precision, and the arc is close enough to a line to not matter
+	const double cosineAboveWhichToInterpolateLinearly = 0.9995;
+	if(cosineOfAngle < cosineAboveWhichToInterpolateLinearly)
+	{
+		const double angle = std::acos(cosineOfAngle);
+		const double sineOfAngle = std::sin(angle);
+		startWeight = std::sin((1 - fractionFromStart) * angle) / sineOfAngle;
+		endWeight = std::sin(fractionFromStart * angle) / sineOfAngle;
+	}
+	endWeight *= endSign;
+
+	return Quaternion(
+		startWeight*start.wValue() + endWeight*end.wValue(),
+		startWeight*start.xValue() + endWeight*end.xValue(),
+		startWeight*start.yValue() + endWeight*end.yValue(),
+		startWeight*start.zValue() + endWeight*end.zValue()).normalized();
+}
\ No newline at end of file
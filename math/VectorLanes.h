@@ -0,0 +1,601 @@
+#pragma once
+
+#include "math/ConstexprMath.h"
+
+#if defined(MATH_TYPES_DISABLE_SIMD)
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__SSE2__)
+#include <emmintrin.h>
+#define MATH_TYPES_USE_SSE
+#elif defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define MATH_TYPES_USE_SSE
+#define MATH_TYPES_USE_SSE_INTRINSICS_ONLY
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define MATH_TYPES_USE_NEON
+#endif
+
+//Four floats held together, in one SIMD register where the platform has them, and the arithmetic on them that
+//the float specialisations of Vector and Matrix are built from. Code elsewhere that works on four values at a
+//time, such as the ray tracer's kernels, uses them too, so that this is the only place which picks a platform.
+//Defining MATH_TYPES_DISABLE_SIMD swaps the registers for plain arrays of floats, e.g. to compare the two.
+//Everything here is constexpr. With GCC and Clang the registers are vector types, whose operators, unlike the
+//intrinsics, work in constant expressions. MSVC's __m128 has no operators, so there the intrinsics are used at
+//run time and each lane is calculated on its own at compile time.
+namespace MathTypes
+{
+	namespace VectorLanes
+	{
+#if defined(MATH_TYPES_USE_SSE)
+		using Lanes = __m128;
+#elif defined(MATH_TYPES_USE_NEON)
+		using Lanes = float32x4_t;
+#else
+		struct Lanes
+		{
+			constexpr float operator[](int i) const;
+
+			float lane[4];
+		};
+#endif
+
+		constexpr Lanes fromComponents(float x, float y, float z, float w);
+		//The same value in every lane
+		constexpr Lanes broadcast(float value);
+		constexpr Lanes fromArray(const float components[4]);
+		constexpr void toArray(Lanes lanes, float components[4]);
+		template<int lane>
+		constexpr float component(Lanes lanes);
+
+		constexpr Lanes sum(Lanes lhs, Lanes rhs);
+		constexpr Lanes difference(Lanes lhs, Lanes rhs);
+		constexpr Lanes product(Lanes lhs, Lanes rhs);
+		constexpr Lanes quotient(Lanes lhs, Lanes rhs);
+		constexpr Lanes squareRoot(Lanes lanes);
+		//The larger of the two in each lane. Which one is returned when a lane holds NaN depends on the platform.
+		constexpr Lanes maximum(Lanes lhs, Lanes rhs);
+		//|x| in each lane, with the sign bit cleared, so -0 becomes +0
+		constexpr Lanes absolute(Lanes lanes);
+		//Each lane of lanes where lhs and rhs are equal in that lane, and zero where they differ
+		constexpr Lanes zeroedWhereDifferent(Lanes lanes, Lanes lhs, Lanes rhs);
+		//1 / sqrt(x) in each lane, from the hardware's estimate refined by Newton-Raphson, which is much faster than
+		//a square root and a division. Within 3e-7 of the exact result relative to it, rather than correctly
+		//rounded, for lanes holding normal positive floats. At compile time and without SIMD, the correctly rounded
+		//square root, then divided.
+		constexpr Lanes approximateReciprocalSquareRoot(Lanes lanes);
+		//Each lane is multiplied by the scalar in double precision and rounded back to float, like the generic
+		//Vector's operator*
+		constexpr Lanes scaledInDoublePrecision(Lanes lanes, double scalar);
+		//((x * x') + (y * y')) + (z * z'), ignoring the fourth lane
+		constexpr float dotProductOfFirstThree(Lanes lhs, Lanes rhs);
+		//Cross product of the first three lanes; the fourth lane of the result is meaningless
+		constexpr Lanes crossProductOfFirstThree(Lanes lhs, Lanes rhs);
+
+		//The same calculations one lane at a time, for the plain arrays and for the registers at compile time
+		constexpr Lanes scaledInDoublePrecisionByLane(Lanes lanes, double scalar);
+		constexpr float dotProductOfFirstThreeByLane(Lanes lhs, Lanes rhs);
+		constexpr Lanes crossProductOfFirstThreeByLane(Lanes lhs, Lanes rhs);
+		constexpr Lanes squareRootByLane(Lanes lanes);
+		constexpr Lanes reciprocalSquareRootByLane(Lanes lanes);
+		constexpr Lanes maximumByLane(Lanes lhs, Lanes rhs);
+		constexpr Lanes absoluteByLane(Lanes lanes);
+		constexpr Lanes zeroedWhereDifferentByLane(Lanes lanes, Lanes lhs, Lanes rhs);
+	}
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::scaledInDoublePrecisionByLane(Lanes lanes, double scalar)
+{
+	return fromComponents(
+		static_cast<float>(component<0>(lanes) * scalar),
+		static_cast<float>(component<1>(lanes) * scalar),
+		static_cast<float>(component<2>(lanes) * scalar),
+		static_cast<float>(component<3>(lanes) * scalar));
+}
+
+constexpr float MathTypes::VectorLanes::dotProductOfFirstThreeByLane(Lanes lhs, Lanes rhs)
+{
+	return (component<0>(lhs) * component<0>(rhs)) + (component<1>(lhs) * component<1>(rhs))
+		+ (component<2>(lhs) * component<2>(rhs));
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::crossProductOfFirstThreeByLane(Lanes lhs, Lanes rhs)
+{
+	const float iScalar = (component<1>(lhs) * component<2>(rhs)) - (component<2>(lhs) * component<1>(rhs));
+	const float jScalar = (component<0>(lhs) * component<2>(rhs)) - (component<2>(lhs) * component<0>(rhs));
+	const float kScalar = (component<0>(lhs) * component<1>(rhs)) - (component<1>(lhs) * component<0>(rhs));
+	return fromComponents(iScalar, -1 * jScalar, kScalar, 0);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::squareRootByLane(Lanes lanes)
+{
+	return fromComponents(
+		ConstexprMath::squareRoot(component<0>(lanes)),
+		ConstexprMath::squareRoot(component<1>(lanes)),
+		ConstexprMath::squareRoot(component<2>(lanes)),
+		ConstexprMath::squareRoot(component<3>(lanes)));
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::reciprocalSquareRootByLane(Lanes lanes)
+{
+	return fromComponents(
+		1 / ConstexprMath::squareRoot(component<0>(lanes)),
+		1 / ConstexprMath::squareRoot(component<1>(lanes)),
+		1 / ConstexprMath::squareRoot(component<2>(lanes)),
+		1 / ConstexprMath::squareRoot(component<3>(lanes)));
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::maximumByLane(Lanes lhs, Lanes rhs)
+{
+	return fromComponents(
+		component<0>(lhs) > component<0>(rhs) ? component<0>(lhs) : component<0>(rhs),
+		component<1>(lhs) > component<1>(rhs) ? component<1>(lhs) : component<1>(rhs),
+		component<2>(lhs) > component<2>(rhs) ? component<2>(lhs) : component<2>(rhs),
+		component<3>(lhs) > component<3>(rhs) ? component<3>(lhs) : component<3>(rhs));
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::absoluteByLane(Lanes lanes)
+{
+	//0 - x rather than -x, so that -0 becomes +0
+	return fromComponents(
+		component<0>(lanes) <= 0 ? 0 - component<0>(lanes) : component<0>(lanes),
+		component<1>(lanes) <= 0 ? 0 - component<1>(lanes) : component<1>(lanes),
+		component<2>(lanes) <= 0 ? 0 - component<2>(lanes) : component<2>(lanes),
+		component<3>(lanes) <= 0 ? 0 - component<3>(lanes) : component<3>(lanes));
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::zeroedWhereDifferentByLane(Lanes lanes, Lanes lhs, Lanes rhs)
+{
+	return fromComponents(
+		component<0>(lhs) == component<0>(rhs) ? component<0>(lanes) : 0,
+		component<1>(lhs) == component<1>(rhs) ? component<1>(lanes) : 0,
+		component<2>(lhs) == component<2>(rhs) ? component<2>(lanes) : 0,
+		component<3>(lhs) == component<3>(rhs) ? component<3>(lanes) : 0);
+}
+
+#if defined(MATH_TYPES_USE_SSE_INTRINSICS_ONLY)
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::fromComponents(float x, float y, float z, float w)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		//Initializes m128_f32, the first member of MSVC's __m128
+		return Lanes{{x, y, z, w}};
+	}
+	return _mm_set_ps(w, z, y, x);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::broadcast(float value)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return Lanes{{value, value, value, value}};
+	}
+	return _mm_set1_ps(value);
+}
+
+template<int lane>
+constexpr float MathTypes::VectorLanes::component(Lanes lanes)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return lanes.m128_f32[lane];
+	}
+	return _mm_cvtss_f32(_mm_shuffle_ps(lanes, lanes, _MM_SHUFFLE(lane, lane, lane, lane)));
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::sum(Lanes lhs, Lanes rhs)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return fromComponents(component<0>(lhs) + component<0>(rhs), component<1>(lhs) + component<1>(rhs),
+			component<2>(lhs) + component<2>(rhs), component<3>(lhs) + component<3>(rhs));
+	}
+	return _mm_add_ps(lhs, rhs);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::difference(Lanes lhs, Lanes rhs)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return fromComponents(component<0>(lhs) - component<0>(rhs), component<1>(lhs) - component<1>(rhs),
+			component<2>(lhs) - component<2>(rhs), component<3>(lhs) - component<3>(rhs));
+	}
+	return _mm_sub_ps(lhs, rhs);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::product(Lanes lhs, Lanes rhs)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return fromComponents(component<0>(lhs) * component<0>(rhs), component<1>(lhs) * component<1>(rhs),
+			component<2>(lhs) * component<2>(rhs), component<3>(lhs) * component<3>(rhs));
+	}
+	return _mm_mul_ps(lhs, rhs);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::quotient(Lanes lhs, Lanes rhs)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return fromComponents(component<0>(lhs) / component<0>(rhs), component<1>(lhs) / component<1>(rhs),
+			component<2>(lhs) / component<2>(rhs), component<3>(lhs) / component<3>(rhs));
+	}
+	return _mm_div_ps(lhs, rhs);
+}
+
+#elif defined(MATH_TYPES_USE_SSE) || defined(MATH_TYPES_USE_NEON)
+
+//The vector type operators compile to the same instructions as the matching intrinsics
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::fromComponents(float x, float y, float z, float w)
+{
+	return Lanes{x, y, z, w};
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::broadcast(float value)
+{
+	return Lanes{value, value, value, value};
+}
+
+template<int lane>
+constexpr float MathTypes::VectorLanes::component(Lanes lanes)
+{
+	return lanes[lane];
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::sum(Lanes lhs, Lanes rhs)
+{
+	return lhs + rhs;
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::difference(Lanes lhs, Lanes rhs)
+{
+	return lhs - rhs;
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::product(Lanes lhs, Lanes rhs)
+{
+	return lhs * rhs;
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::quotient(Lanes lhs, Lanes rhs)
+{
+	return lhs / rhs;
+}
+
+#endif
+
+#if defined(MATH_TYPES_USE_SSE)
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::fromArray(const float components[4])
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return fromComponents(components[0], components[1], components[2], components[3]);
+	}
+	return _mm_loadu_ps(components);
+}
+
+constexpr void MathTypes::VectorLanes::toArray(Lanes lanes, float components[4])
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		components[0] = component<0>(lanes);
+		components[1] = component<1>(lanes);
+		components[2] = component<2>(lanes);
+		components[3] = component<3>(lanes);
+		return;
+	}
+	_mm_storeu_ps(components, lanes);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::squareRoot(Lanes lanes)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return squareRootByLane(lanes);
+	}
+	return _mm_sqrt_ps(lanes);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::maximum(Lanes lhs, Lanes rhs)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return maximumByLane(lhs, rhs);
+	}
+	return _mm_max_ps(lhs, rhs);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::absolute(Lanes lanes)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return absoluteByLane(lanes);
+	}
+	return _mm_andnot_ps(_mm_set1_ps(-0.0f), lanes);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::zeroedWhereDifferent(Lanes lanes, Lanes lhs, Lanes rhs)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return zeroedWhereDifferentByLane(lanes, lhs, rhs);
+	}
+	return _mm_and_ps(_mm_cmpeq_ps(lhs, rhs), lanes);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::approximateReciprocalSquareRoot(Lanes lanes)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return reciprocalSquareRootByLane(lanes);
+	}
+	//The estimate is within 1.5 * 2^-12, and one step of y(1.5 - 0.5 x y^2) squares that error. The product is
+	//rounded as ((0.5 x) y) y, the order the ray tracer's camera rays were first normalised in, which keeps its
+	//images the same.
+	const __m128 estimate = _mm_rsqrt_ps(lanes);
+	const __m128 halfOfLanesTimesEstimateSquared =
+		_mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), lanes), estimate), estimate);
+	return _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(1.5f), halfOfLanesTimesEstimateSquared));
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::scaledInDoublePrecision(Lanes lanes, double scalar)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return scaledInDoublePrecisionByLane(lanes, scalar);
+	}
+	//A float times a float is exact in double precision, so when the scalar is a float, rounding the double
+	//product to float is the same as multiplying in float
+	const float floatScalar = static_cast<float>(scalar);
+	if(floatScalar == scalar)
+	{
+		return _mm_mul_ps(lanes, _mm_set1_ps(floatScalar));
+	}
+	const __m128d scalarLanes = _mm_set1_pd(scalar);
+	const __m128d firstTwo = _mm_mul_pd(_mm_cvtps_pd(lanes), scalarLanes);
+	const __m128d lastTwo = _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(lanes, lanes)), scalarLanes);
+	return _mm_movelh_ps(_mm_cvtpd_ps(firstTwo), _mm_cvtpd_ps(lastTwo));
+}
+
+constexpr float MathTypes::VectorLanes::dotProductOfFirstThree(Lanes lhs, Lanes rhs)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return dotProductOfFirstThreeByLane(lhs, rhs);
+	}
+	const __m128 products = _mm_mul_ps(lhs, rhs);
+	const __m128 sumOfFirstTwo = _mm_add_ss(products, _mm_shuffle_ps(products, products, _MM_SHUFFLE(1, 1, 1, 1)));
+	return _mm_cvtss_f32(_mm_add_ss(sumOfFirstTwo, _mm_movehl_ps(products, products)));
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::crossProductOfFirstThree(Lanes lhs, Lanes rhs)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return crossProductOfFirstThreeByLane(lhs, rhs);
+	}
+	//(y z' - z y', -(x z' - z x'), x y' - y x'), with the middle component negated after the subtraction as the
+	//generic crossProduct does, so that zeros get the same sign
+	const __m128 lhsYXX = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 0, 0, 1));
+	const __m128 rhsZZY = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 1, 2, 2));
+	const __m128 lhsZZY = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 1, 2, 2));
+	const __m128 rhsYXX = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 0, 0, 1));
+	const __m128 differences = _mm_sub_ps(_mm_mul_ps(lhsYXX, rhsZZY), _mm_mul_ps(lhsZZY, rhsYXX));
+	return _mm_xor_ps(differences, _mm_set_ps(0, 0, -0.0f, 0));
+}
+
+#elif defined(MATH_TYPES_USE_NEON)
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::fromArray(const float components[4])
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return fromComponents(components[0], components[1], components[2], components[3]);
+	}
+	return vld1q_f32(components);
+}
+
+constexpr void MathTypes::VectorLanes::toArray(Lanes lanes, float components[4])
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		components[0] = component<0>(lanes);
+		components[1] = component<1>(lanes);
+		components[2] = component<2>(lanes);
+		components[3] = component<3>(lanes);
+		return;
+	}
+	vst1q_f32(components, lanes);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::squareRoot(Lanes lanes)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return squareRootByLane(lanes);
+	}
+	return vsqrtq_f32(lanes);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::maximum(Lanes lhs, Lanes rhs)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return maximumByLane(lhs, rhs);
+	}
+	return vmaxq_f32(lhs, rhs);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::absolute(Lanes lanes)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return absoluteByLane(lanes);
+	}
+	return vabsq_f32(lanes);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::zeroedWhereDifferent(Lanes lanes, Lanes lhs, Lanes rhs)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return zeroedWhereDifferentByLane(lanes, lhs, rhs);
+	}
+	return vreinterpretq_f32_u32(vandq_u32(vceqq_f32(lhs, rhs), vreinterpretq_u32_f32(lanes)));
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::approximateReciprocalSquareRoot(Lanes lanes)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return reciprocalSquareRootByLane(lanes);
+	}
+	//The estimate is only good to about 2^-8, so it takes two steps of y(3 - x y^2) / 2 to match SSE's one
+	float32x4_t estimate = vrsqrteq_f32(lanes);
+	estimate = vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(lanes, estimate), estimate));
+	return vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(lanes, estimate), estimate));
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::scaledInDoublePrecision(Lanes lanes, double scalar)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return scaledInDoublePrecisionByLane(lanes, scalar);
+	}
+	const float floatScalar = static_cast<float>(scalar);
+	if(floatScalar == scalar)
+	{
+		return vmulq_n_f32(lanes, floatScalar);
+	}
+	const float64x2_t scalarLanes = vdupq_n_f64(scalar);
+	const float32x2_t firstTwo = vcvt_f32_f64(vmulq_f64(vcvt_f64_f32(vget_low_f32(lanes)), scalarLanes));
+	const float32x2_t lastTwo = vcvt_f32_f64(vmulq_f64(vcvt_f64_f32(vget_high_f32(lanes)), scalarLanes));
+	return vcombine_f32(firstTwo, lastTwo);
+}
+
+constexpr float MathTypes::VectorLanes::dotProductOfFirstThree(Lanes lhs, Lanes rhs)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return dotProductOfFirstThreeByLane(lhs, rhs);
+	}
+	//vmul rather than a fused multiply-add, which would round differently from the generic Vector
+	const float32x4_t products = vmulq_f32(lhs, rhs);
+	return (vgetq_lane_f32(products, 0) + vgetq_lane_f32(products, 1)) + vgetq_lane_f32(products, 2);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::crossProductOfFirstThree(Lanes lhs, Lanes rhs)
+{
+	if(MATH_TYPES_IS_CONSTANT_EVALUATED())
+	{
+		return crossProductOfFirstThreeByLane(lhs, rhs);
+	}
+	const float lhsYXX[4] = {vgetq_lane_f32(lhs, 1), vgetq_lane_f32(lhs, 0), vgetq_lane_f32(lhs, 0), 0};
+	const float rhsZZY[4] = {vgetq_lane_f32(rhs, 2), vgetq_lane_f32(rhs, 2), vgetq_lane_f32(rhs, 1), 0};
+	const float lhsZZY[4] = {vgetq_lane_f32(lhs, 2), vgetq_lane_f32(lhs, 2), vgetq_lane_f32(lhs, 1), 0};
+	const float rhsYXX[4] = {vgetq_lane_f32(rhs, 1), vgetq_lane_f32(rhs, 0), vgetq_lane_f32(rhs, 0), 0};
+	const float signs[4] = {1, -1, 1, 1};
+	const float32x4_t differences = vsubq_f32(
+		vmulq_f32(vld1q_f32(lhsYXX), vld1q_f32(rhsZZY)), vmulq_f32(vld1q_f32(lhsZZY), vld1q_f32(rhsYXX)));
+	return vmulq_f32(differences, vld1q_f32(signs));
+}
+
+#else
+
+constexpr float MathTypes::VectorLanes::Lanes::operator[](int i) const
+{
+	return lane[i];
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::fromComponents(float x, float y, float z, float w)
+{
+	return Lanes{{x, y, z, w}};
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::broadcast(float value)
+{
+	return Lanes{{value, value, value, value}};
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::fromArray(const float components[4])
+{
+	return Lanes{{components[0], components[1], components[2], components[3]}};
+}
+
+constexpr void MathTypes::VectorLanes::toArray(Lanes lanes, float components[4])
+{
+	for(int i = 0; i < 4; i++)
+	{
+		components[i] = lanes.lane[i];
+	}
+}
+
+template<int lane>
+constexpr float MathTypes::VectorLanes::component(Lanes lanes)
+{
+	return lanes.lane[lane];
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::sum(Lanes lhs, Lanes rhs)
+{
+	return Lanes{{lhs.lane[0] + rhs.lane[0], lhs.lane[1] + rhs.lane[1], lhs.lane[2] + rhs.lane[2], lhs.lane[3] + rhs.lane[3]}};
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::difference(Lanes lhs, Lanes rhs)
+{
+	return Lanes{{lhs.lane[0] - rhs.lane[0], lhs.lane[1] - rhs.lane[1], lhs.lane[2] - rhs.lane[2], lhs.lane[3] - rhs.lane[3]}};
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::product(Lanes lhs, Lanes rhs)
+{
+	return Lanes{{lhs.lane[0] * rhs.lane[0], lhs.lane[1] * rhs.lane[1], lhs.lane[2] * rhs.lane[2], lhs.lane[3] * rhs.lane[3]}};
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::quotient(Lanes lhs, Lanes rhs)
+{
+	return Lanes{{lhs.lane[0] / rhs.lane[0], lhs.lane[1] / rhs.lane[1], lhs.lane[2] / rhs.lane[2], lhs.lane[3] / rhs.lane[3]}};
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::squareRoot(Lanes lanes)
+{
+	return squareRootByLane(lanes);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::maximum(Lanes lhs, Lanes rhs)
+{
+	return maximumByLane(lhs, rhs);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::absolute(Lanes lanes)
+{
+	return absoluteByLane(lanes);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::zeroedWhereDifferent(Lanes lanes, Lanes lhs, Lanes rhs)
+{
+	return zeroedWhereDifferentByLane(lanes, lhs, rhs);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::approximateReciprocalSquareRoot(Lanes lanes)
+{
+	return reciprocalSquareRootByLane(lanes);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::scaledInDoublePrecision(Lanes lanes, double scalar)
+{
+	return scaledInDoublePrecisionByLane(lanes, scalar);
+}
+
+constexpr float MathTypes::VectorLanes::dotProductOfFirstThree(Lanes lhs, Lanes rhs)
+{
+	return dotProductOfFirstThreeByLane(lhs, rhs);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::VectorLanes::crossProductOfFirstThree(Lanes lhs, Lanes rhs)
+{
+	return crossProductOfFirstThreeByLane(lhs, rhs);
+}
+
+#endif
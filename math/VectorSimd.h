@@ -0,0 +1,258 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <typeinfo>
+
+#include "math/Matrix.h"
+#include "math/VectorLanes.h"
+
+//Float specialisations of Vector<3> and Vector<4> that keep their components together in one SIMD register and
+//calculate them all at once. Only included from Vector.h.
+//Each lane is calculated exactly like the generic Vector calculates its components, in the same order and at the
+//same precision, so both give identical results.
+namespace MathTypes
+{
+	template<>
+	class Vector<3, float>
+	{
+	public:
+		constexpr Vector(float x, float y, float z);
+		constexpr explicit Vector(std::array<float, 3> data);
+		//The fourth lane is ignored
+		constexpr explicit Vector(VectorLanes::Lanes lanes);
+
+		constexpr float xValue() const;
+		constexpr float yValue() const;
+		constexpr float zValue() const;
+
+		constexpr float magnitude() const;
+		constexpr float magnitudeSquared() const;
+		constexpr Vector<3, float> normalized() const;
+		constexpr Vector<4, float> homogenized() const;
+		constexpr explicit operator Matrix<3, 1, float>() const;
+
+		std::string toString() const;
+
+		constexpr VectorLanes::Lanes lanes() const;
+
+	private:
+		//The fourth lane is zero when constructed from components, but may hold anything after arithmetic
+		VectorLanes::Lanes lanes_;
+	};
+
+	template<>
+	class Vector<4, float>
+	{
+	public:
+		constexpr Vector(float x, float y, float z, float w);
+		constexpr explicit Vector(std::array<float, 4> data);
+		constexpr explicit Vector(VectorLanes::Lanes lanes);
+
+		constexpr float xValue() const;
+		constexpr float yValue() const;
+		constexpr float zValue() const;
+		constexpr float wValue() const;
+
+		constexpr explicit operator Matrix<4, 1, float>() const;
+
+		std::string toString() const;
+
+		constexpr VectorLanes::Lanes lanes() const;
+
+	private:
+		VectorLanes::Lanes lanes_;
+	};
+}
+
+constexpr MathTypes::Vector<3, float>::Vector(float x, float y, float z)
+	: lanes_(VectorLanes::fromComponents(x, y, z, 0))
+{
+}
+
+constexpr MathTypes::Vector<3, float>::Vector(std::array<float, 3> data)
+	: lanes_(VectorLanes::fromComponents(data[0], data[1], data[2], 0))
+{
+}
+
+constexpr MathTypes::Vector<3, float>::Vector(VectorLanes::Lanes lanes)
+	: lanes_(lanes)
+{
+}
+
+constexpr float MathTypes::Vector<3, float>::xValue() const
+{
+	return VectorLanes::component<0>(lanes_);
+}
+
+constexpr float MathTypes::Vector<3, float>::yValue() const
+{
+	return VectorLanes::component<1>(lanes_);
+}
+
+constexpr float MathTypes::Vector<3, float>::zValue() const
+{
+	return VectorLanes::component<2>(lanes_);
+}
+
+constexpr float MathTypes::Vector<3, float>::magnitude() const
+{
+	return ConstexprMath::squareRoot(magnitudeSquared());
+}
+
+constexpr float MathTypes::Vector<3, float>::magnitudeSquared() const
+{
+	return VectorLanes::dotProductOfFirstThree(lanes_, lanes_);
+}
+
+constexpr MathTypes::Vector<3, float> MathTypes::Vector<3, float>::normalized() const
+{
+	const float normalizingScalar = 1.0 / this->magnitude();
+	return Vector<3, float>(VectorLanes::product(lanes_, VectorLanes::broadcast(normalizingScalar)));
+}
+
+constexpr MathTypes::Vector<4, float> MathTypes::Vector<3, float>::homogenized() const
+{
+	return Vector<4, float>(xValue(), yValue(), zValue(), 1);
+}
+
+constexpr MathTypes::Vector<3, float>::operator Matrix<3, 1, float>() const
+{
+	float columnVector[3][1] = {
+		{xValue()},
+		{yValue()},
+		{zValue()}
+	};
+
+	return MathTypes::Matrix<3, 1, float>(columnVector);
+}
+
+inline std::string MathTypes::Vector<3, float>::toString() const
+{
+	const char* formatString = "Three Dimensional Vector. (%.3f, %.3f, %.3f). Coordinate Type: %s";
+	char buffer[100];
+
+	sprintf(buffer, formatString, xValue(), yValue(), zValue(), typeid(float).name());
+
+	return std::string(buffer);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::Vector<3, float>::lanes() const
+{
+	return lanes_;
+}
+
+constexpr MathTypes::Vector<3, float> operator+(const MathTypes::Vector<3, float>& lhs, const MathTypes::Vector<3, float>& rhs)
+{
+	return MathTypes::Vector<3, float>(MathTypes::VectorLanes::sum(lhs.lanes(), rhs.lanes()));
+}
+
+constexpr MathTypes::Vector<3, float> operator-(const MathTypes::Vector<3, float>& lhs, const MathTypes::Vector<3, float>& rhs)
+{
+	return MathTypes::Vector<3, float>(MathTypes::VectorLanes::difference(lhs.lanes(), rhs.lanes()));
+}
+
+constexpr MathTypes::Vector<3, float> operator*(const MathTypes::Vector<3, float>& lhs, double scalar)
+{
+	return MathTypes::Vector<3, float>(MathTypes::VectorLanes::scaledInDoublePrecision(lhs.lanes(), scalar));
+}
+
+constexpr MathTypes::Vector<3, float> operator*(double scalar, const MathTypes::Vector<3, float>& rhs)
+{
+	return rhs * scalar;
+}
+
+constexpr bool operator==(const MathTypes::Vector<3, float>& lhs, const MathTypes::Vector<3, float>& rhs)
+{
+	return (lhs.xValue() == rhs.xValue()) && (lhs.yValue() == rhs.yValue()) && (lhs.zValue() == rhs.zValue());
+}
+
+constexpr MathTypes::Vector<4, float>::Vector(float x, float y, float z, float w)
+	: lanes_(VectorLanes::fromComponents(x, y, z, w))
+{
+}
+
+constexpr MathTypes::Vector<4, float>::Vector(std::array<float, 4> data)
+	: lanes_(VectorLanes::fromComponents(data[0], data[1], data[2], data[3]))
+{
+}
+
+constexpr MathTypes::Vector<4, float>::Vector(VectorLanes::Lanes lanes)
+	: lanes_(lanes)
+{
+}
+
+constexpr float MathTypes::Vector<4, float>::xValue() const
+{
+	return VectorLanes::component<0>(lanes_);
+}
+
+constexpr float MathTypes::Vector<4, float>::yValue() const
+{
+	return VectorLanes::component<1>(lanes_);
+}
+
+constexpr float MathTypes::Vector<4, float>::zValue() const
+{
+	return VectorLanes::component<2>(lanes_);
+}
+
+constexpr float MathTypes::Vector<4, float>::wValue() const
+{
+	return VectorLanes::component<3>(lanes_);
+}
+
+constexpr MathTypes::Vector<4, float>::operator Matrix<4, 1, float>() const
+{
+	float columnVector[4][1] = {
+		{xValue()},
+		{yValue()},
+		{zValue()},
+		{wValue()}
+	};
+
+	return MathTypes::Matrix<4, 1, float>(columnVector);
+}
+
+inline std::string MathTypes::Vector<4, float>::toString() const
+{
+	const char* formatString = "Four Dimensional Vector. (%.3f, %.3f, %.3f, %.3f). Coordinate Type: %s";
+	char buffer[100];
+
+	sprintf(buffer, formatString, xValue(), yValue(), zValue(), wValue(), typeid(float).name());
+
+	return std::string(buffer);
+}
+
+constexpr MathTypes::VectorLanes::Lanes MathTypes::Vector<4, float>::lanes() const
+{
+	return lanes_;
+}
+
+constexpr MathTypes::Vector<4, float> operator+(const MathTypes::Vector<4, float>& lhs, const MathTypes::Vector<4, float>& rhs)
+{
+	return MathTypes::Vector<4, float>(MathTypes::VectorLanes::sum(lhs.lanes(), rhs.lanes()));
+}
+
+constexpr MathTypes::Vector<4, float> operator-(const MathTypes::Vector<4, float>& lhs, const MathTypes::Vector<4, float>& rhs)
+{
+	return MathTypes::Vector<4, float>(MathTypes::VectorLanes::difference(lhs.lanes(), rhs.lanes()));
+}
+
+constexpr MathTypes::Vector<4, float> operator*(const MathTypes::Vector<4, float>& lhs, double scalar)
+{
+	return MathTypes::Vector<4, float>(MathTypes::VectorLanes::scaledInDoublePrecision(lhs.lanes(), scalar));
+}
+
+constexpr MathTypes::Vector<4, float> operator*(double scalar, const MathTypes::Vector<4, float>& rhs)
+{
+	return rhs * scalar;
+}
+
+constexpr bool operator==(const MathTypes::Vector<4, float>& lhs, const MathTypes::Vector<4, float>& rhs)
+{
+	return (lhs.xValue() == rhs.xValue()) && (lhs.yValue() == rhs.yValue()) && (lhs.zValue() == rhs.zValue())
+		&& (lhs.wValue() == rhs.wValue());
+}
\ No newline at end of file
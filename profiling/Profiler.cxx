@@ -0,0 +1,160 @@
+#include "profiling/Profiler.h"
+
+#ifdef ENABLE_PROFILING
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+	struct Zone
+	{
+		const char* name;
+		std::int64_t start;
+		std::int64_t end;
+	};
+
+	const int ZONES_PER_CHUNK = 4096;
+	//Caps a thread at about four million zones, or 96 MB
+	const int MAXIMUM_CHUNKS_PER_THREAD = 1024;
+
+	//The zones of one thread. They are stored in chunks that the thread allocates as it fills them and that never
+	//move, so the trace can be written while the thread keeps recording: a zone is only counted in numberOfZones
+	//once it has been filled in, and nothing below that count is written again.
+	struct ThreadBuffer
+	{
+		explicit ThreadBuffer(int threadNumber);
+
+		const int threadNumber;
+		std::unique_ptr<Zone[]> chunks[MAXIMUM_CHUNKS_PER_THREAD];
+		std::atomic<int> numberOfZones;
+		//Zones that arrived after every chunk was full
+		std::atomic<int> numberOfDroppedZones;
+	};
+
+	ThreadBuffer::ThreadBuffer(int threadNumber)
+		: threadNumber(threadNumber)
+		, numberOfZones(0)
+		, numberOfDroppedZones(0)
+	{
+	}
+
+	//Buffers outlive their threads, so that zones of threads that have finished still make it into the trace
+	struct BufferRegistry
+	{
+		std::mutex mutex;
+		std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+	};
+
+	BufferRegistry& bufferRegistry()
+	{
+		static BufferRegistry registry;
+		return registry;
+	}
+
+	ThreadBuffer& bufferOfThisThread()
+	{
+		thread_local ThreadBuffer* buffer = NULL;
+		if(buffer == NULL)
+		{
+			auto& registry = bufferRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			registry.buffers.push_back(std::make_unique<ThreadBuffer>(registry.buffers.size()));
+			buffer = registry.buffers.back().get();
+		}
+		return *buffer;
+	}
+
+	void writeEscapedString(std::ostream& output, const char* string)
+	{
+		output << '"';
+		for(const char* character = string; *character != '\0'; character++)
+		{
+			if(*character == '"' || *character == '\\')
+			{
+				output << '\\' << *character;
+			}
+			else if(static_cast<unsigned char>(*character) < 0x20)
+			{
+				output << ' ';
+			}
+			else
+			{
+				output << *character;
+			}
+		}
+		output << '"';
+	}
+}
+
+std::int64_t Profiling::currentTime()
+{
+	static const auto startOfProfiling = std::chrono::steady_clock::now();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startOfProfiling).count();
+}
+
+void Profiling::recordZone(const char* name, std::int64_t start, std::int64_t end)
+{
+	auto& buffer = bufferOfThisThread();
+	const int zone = buffer.numberOfZones.load(std::memory_order_relaxed);
+	const int chunk = zone / ZONES_PER_CHUNK;
+	if(chunk >= MAXIMUM_CHUNKS_PER_THREAD)
+	{
+		buffer.numberOfDroppedZones.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	if(buffer.chunks[chunk] == NULL)
+	{
+		buffer.chunks[chunk].reset(new Zone[ZONES_PER_CHUNK]);
+	}
+	buffer.chunks[chunk][zone % ZONES_PER_CHUNK] = Zone{name, start, end};
+	buffer.numberOfZones.store(zone + 1, std::memory_order_release);
+}
+
+bool Profiling::writeChromeTrace(const std::string& fileName)
+{
+	std::ofstream file(fileName);
+	//Trace event timestamps are in microseconds
+	file << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+	bool firstEvent = true;
+	auto separateEvent = [&]()
+	{
+		file << (firstEvent ? "\n" : ",\n");
+		firstEvent = false;
+	};
+
+	auto& registry = bufferRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	for(const auto& buffer : registry.buffers)
+	{
+		const int zones = buffer->numberOfZones.load(std::memory_order_acquire);
+		for(int i = 0; i < zones; i++)
+		{
+			const Zone& zone = buffer->chunks[i / ZONES_PER_CHUNK][i % ZONES_PER_CHUNK];
+			separateEvent();
+			file << "{\"name\":";
+			writeEscapedString(file, zone.name);
+			file << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->threadNumber
+				<< ",\"ts\":" << zone.start / 1000.0 << ",\"dur\":" << (zone.end - zone.start) / 1000.0 << "}";
+		}
+
+		separateEvent();
+		file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->threadNumber
+			<< ",\"args\":{\"name\":\"Thread " << buffer->threadNumber;
+		const int droppedZones = buffer->numberOfDroppedZones.load(std::memory_order_relaxed);
+		if(droppedZones > 0)
+		{
+			file << " (" << droppedZones << " zones dropped)";
+		}
+		file << "\"}}";
+	}
+	file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+	return static_cast<bool>(file);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+//Scoped timing zones for finding where the executables spend their time. A zone is opened with
+//PROFILE_SCOPE("name") and closed at the end of the enclosing scope, and the zones recorded by every thread are
+//written out with PROFILE_WRITE_CHROME_TRACE("file.json") in Chrome's trace event format, which chrome://tracing
+//and Perfetto display as a timeline.
+//Profiling is compiled in only when ENABLE_PROFILING is defined. Otherwise both macros expand to nothing and
+//Profiler.cxx is empty, so instrumented code costs nothing.
+//Zone names must be string literals, or otherwise outlive the trace; only the pointer is recorded.
+
+#ifdef ENABLE_PROFILING
+
+#include <cstdint>
+#include <string>
+
+namespace Profiling
+{
+	//Nanoseconds since the profiler was first used
+	std::int64_t currentTime();
+	//Appends a finished zone to the calling thread's buffer. Each thread only ever writes to its own buffer, so
+	//this takes no lock; a thread's first zone registers its buffer, which does.
+	void recordZone(const char* name, std::int64_t start, std::int64_t end);
+	//Zones still being recorded by other threads while the trace is written may be left out of it, but are
+	//never read half written
+	bool writeChromeTrace(const std::string& fileName);
+
+	class ScopedZone
+	{
+	public:
+		explicit ScopedZone(const char* name);
+		~ScopedZone();
+
+		ScopedZone(const ScopedZone&) = delete;
+		ScopedZone& operator=(const ScopedZone&) = delete;
+
+	private:
+		const char* name_;
+		std::int64_t start_;
+	};
+}
+
+inline Profiling::ScopedZone::ScopedZone(const char* name)
+	: name_(name)
+	, start_(currentTime())
+{
+}
+
+inline Profiling::ScopedZone::~ScopedZone()
+{
+	recordZone(name_, start_, currentTime());
+}
+
+#define PROFILE_JOIN_NAMES(a, b) a##b
+#define PROFILE_ZONE_NAME(line) PROFILE_JOIN_NAMES(profileZoneOnLine, line)
+#define PROFILE_SCOPE(name) Profiling::ScopedZone PROFILE_ZONE_NAME(__LINE__)(name)
+#define PROFILE_WRITE_CHROME_TRACE(fileName) Profiling::writeChromeTrace(fileName)
+
+#else
+
+#define PROFILE_SCOPE(name)
+#define PROFILE_WRITE_CHROME_TRACE(fileName)
+
+#endif
\ No newline at end of file
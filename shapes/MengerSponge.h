@@ -0,0 +1,87 @@
+#pragma once
+
+#include "math/LinearMath.h"
+#include "math/Matrix.h"
+#include "math/Vector.h"
+
+namespace Shapes
+{
+	//The Menger sponge fractal: a cube split into 3x3x3 sub-cubes, of which the centre and the centres of the faces
+	//are removed, with the same done again to each remaining sub-cube levelOfRecursion times. Only the rule is
+	//stored, not the 20^levelOfRecursion cubes it produces.
+	template<typename CoordinatePrimitive>
+	class MengerSponge
+	{
+	public:
+		//Like Cube, the sponge starts at frontBottomLeft and extends in the directions +x, +y, and -z
+		MengerSponge(
+			const MathTypes::Vector<3, CoordinatePrimitive>& frontBottomLeft,
+			CoordinatePrimitive sideLength,
+			int levelOfRecursion);
+		~MengerSponge() = default;
+
+		MathTypes::Vector<3, CoordinatePrimitive> frontBottomLeft() const;
+		CoordinatePrimitive sideLength() const;
+		int levelOfRecursion() const;
+
+		//Whether the sub-cube at the given position in the 3x3x3 split of a cube is kept. Indices run from 0 to 2
+		//along +x, +y, and -z respectively. A sub-cube is removed when at least two of its indices are 1.
+		static bool subCubeIsSolid(int widthIndex, int heightIndex, int depthIndex);
+
+		//Moves the corner by the transformation. The sponge stays aligned with the axes, so the side length is
+		//scaled by how much the transformation stretches the x axis.
+		void transform(const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformationMatrix);
+
+	private:
+		MathTypes::Vector<3, CoordinatePrimitive> frontBottomLeft_;
+		CoordinatePrimitive sideLength_;
+		int levelOfRecursion_;
+	};
+}
+
+template<typename CoordinatePrimitive>
+Shapes::MengerSponge<CoordinatePrimitive>::MengerSponge(
+	const MathTypes::Vector<3, CoordinatePrimitive>& frontBottomLeft,
+	CoordinatePrimitive sideLength,
+	int levelOfRecursion)
+	: frontBottomLeft_(frontBottomLeft)
+	, sideLength_(sideLength)
+	, levelOfRecursion_(levelOfRecursion)
+{
+}
+
+template<typename CoordinatePrimitive>
+MathTypes::Vector<3, CoordinatePrimitive> Shapes::MengerSponge<CoordinatePrimitive>::frontBottomLeft() const
+{
+	return frontBottomLeft_;
+}
+
+template<typename CoordinatePrimitive>
+CoordinatePrimitive Shapes::MengerSponge<CoordinatePrimitive>::sideLength() const
+{
+	return sideLength_;
+}
+
+template<typename CoordinatePrimitive>
+int Shapes::MengerSponge<CoordinatePrimitive>::levelOfRecursion() const
+{
+	return levelOfRecursion_;
+}
+
+template<typename CoordinatePrimitive>
+bool Shapes::MengerSponge<CoordinatePrimitive>::subCubeIsSolid(int widthIndex, int heightIndex, int depthIndex)
+{
+	const int centredIndices = (widthIndex == 1) + (heightIndex == 1) + (depthIndex == 1);
+	return centredIndices < 2;
+}
+
+template<typename CoordinatePrimitive>
+void Shapes::MengerSponge<CoordinatePrimitive>::transform(
+	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformationMatrix)
+{
+	frontBottomLeft_ = LinearMath::transformPoint(transformationMatrix, frontBottomLeft_);
+
+	auto transformedXAxis = MathTypes::Vector<3, CoordinatePrimitive>(
+		transformationMatrix[0][0], transformationMatrix[1][0], transformationMatrix[2][0]);
+	sideLength_ = sideLength_ * transformedXAxis.magnitude();
+}
\ No newline at end of file
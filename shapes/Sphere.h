@@ -1,42 +1,59 @@
-#pragma once
-
-#include "math/Vector.h"
-
-namespace Shapes
-{
-	template<typename CoordinatePrimitive>
-	class Sphere
-	{
-	public:
-		Sphere(CoordinatePrimitive radius, const MathTypes::Vector<3, CoordinatePrimitive>& centre);
-		~Sphere() = default;
-
-		CoordinatePrimitive radius() const;
-		MathTypes::Vector<3, CoordinatePrimitive> centre() const;
-
-	private:
-		const CoordinatePrimitive radius_;
-		const MathTypes::Vector<3, CoordinatePrimitive> centre_;
-	};
-}
-
-template<typename CoordinatePrimitive>
-Shapes::Sphere<CoordinatePrimitive>::Sphere(
-	const CoordinatePrimitive radius, 
-	const MathTypes::Vector<3, CoordinatePrimitive>& centre)
-	: radius_(radius)
-	, centre_(centre)
-{
-}
-
-template<typename CoordinatePrimitive>
-CoordinatePrimitive Shapes::Sphere<CoordinatePrimitive>::radius() const
-{
-	return radius_;
-}
-
-template<typename CoordinatePrimitive>
-MathTypes::Vector<3, CoordinatePrimitive> Shapes::Sphere<CoordinatePrimitive>::centre() const
-{
-	return centre_;
+#pragma once
+
+#include "math/LinearMath.h"
+#include "math/Matrix.h"
+#include "math/Vector.h"
+
+namespace Shapes
+{
+	template<typename CoordinatePrimitive>
+	class Sphere
+	{
+	public:
+		Sphere(CoordinatePrimitive radius, const MathTypes::Vector<3, CoordinatePrimitive>& centre);
+		~Sphere() = default;
+
+		CoordinatePrimitive radius() const;
+		MathTypes::Vector<3, CoordinatePrimitive> centre() const;
+
+		//Moves the centre by the transformation. A sphere can only represent uniform scaling, so the radius is
+		//scaled by how much the transformation stretches the x axis.
+		void transform(const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformationMatrix);
+
+	private:
+		CoordinatePrimitive radius_;
+		MathTypes::Vector<3, CoordinatePrimitive> centre_;
+	};
+}
+
+template<typename CoordinatePrimitive>
+Shapes::Sphere<CoordinatePrimitive>::Sphere(
+	const CoordinatePrimitive radius, 
+	const MathTypes::Vector<3, CoordinatePrimitive>& centre)
+	: radius_(radius)
+	, centre_(centre)
+{
+}
+
+template<typename CoordinatePrimitive>
+CoordinatePrimitive Shapes::Sphere<CoordinatePrimitive>::radius() const
+{
+	return radius_;
+}
+
+template<typename CoordinatePrimitive>
+MathTypes::Vector<3, CoordinatePrimitive> Shapes::Sphere<CoordinatePrimitive>::centre() const
+{
+	return centre_;
+}
+
+template<typename CoordinatePrimitive>
+void Shapes::Sphere<CoordinatePrimitive>::transform(
+	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformationMatrix)
+{
+	centre_ = LinearMath::transformPoint(transformationMatrix, centre_);
+
+	auto transformedXAxis = MathTypes::Vector<3, CoordinatePrimitive>(
+		transformationMatrix[0][0], transformationMatrix[1][0], transformationMatrix[2][0]);
+	radius_ = radius_ * transformedXAxis.magnitude();
 }
\ No newline at end of file
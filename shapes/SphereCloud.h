@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cassert>
+#include <vector>
+
+#include "math/BatchTransforms.h"
+#include "math/Matrix.h"
+#include "math/Vector.h"
+
+namespace Shapes
+{
+	//Many spheres of the same radius, such as particles or atoms. Centres are kept as one flat array per
+	//coordinate so that a sphere costs three coordinates of memory rather than a whole object.
+	template<typename CoordinatePrimitive>
+	class SphereCloud
+	{
+	public:
+		SphereCloud(CoordinatePrimitive radius);
+		SphereCloud(CoordinatePrimitive radius, const std::vector<MathTypes::Vector<3, CoordinatePrimitive>>& centres);
+		~SphereCloud() = default;
+
+		void addSphere(const MathTypes::Vector<3, CoordinatePrimitive>& centre);
+		void reserve(int numberOfSpheres);
+
+		CoordinatePrimitive radius() const;
+		int numberOfSpheres() const;
+		MathTypes::Vector<3, CoordinatePrimitive> centre(int sphereIndex) const;
+		const std::vector<CoordinatePrimitive>& xCoordinates() const;
+		const std::vector<CoordinatePrimitive>& yCoordinates() const;
+		const std::vector<CoordinatePrimitive>& zCoordinates() const;
+
+		//Reorders the spheres so that the sphere at index i moves to index newOrder[i]
+		void reorder(const std::vector<int>& newOrder);
+
+		//Moves every centre by the transformation. Like a single sphere, the radius is scaled by how much the
+		//transformation stretches the x axis.
+		void transform(const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformationMatrix);
+
+	private:
+		CoordinatePrimitive radius_;
+		std::vector<CoordinatePrimitive> x_;
+		std::vector<CoordinatePrimitive> y_;
+		std::vector<CoordinatePrimitive> z_;
+	};
+}
+
+template<typename CoordinatePrimitive>
+Shapes::SphereCloud<CoordinatePrimitive>::SphereCloud(CoordinatePrimitive radius)
+	: radius_(radius)
+{
+}
+
+template<typename CoordinatePrimitive>
+Shapes::SphereCloud<CoordinatePrimitive>::SphereCloud(
+	CoordinatePrimitive radius,
+	const std::vector<MathTypes::Vector<3, CoordinatePrimitive>>& centres)
+	: radius_(radius)
+{
+	reserve(centres.size());
+	for(const auto& centre : centres)
+	{
+		addSphere(centre);
+	}
+}
+
+template<typename CoordinatePrimitive>
+void Shapes::SphereCloud<CoordinatePrimitive>::addSphere(const MathTypes::Vector<3, CoordinatePrimitive>& centre)
+{
+	x_.push_back(centre.xValue());
+	y_.push_back(centre.yValue());
+	z_.push_back(centre.zValue());
+}
+
+template<typename CoordinatePrimitive>
+void Shapes::SphereCloud<CoordinatePrimitive>::reserve(int numberOfSpheres)
+{
+	x_.reserve(numberOfSpheres);
+	y_.reserve(numberOfSpheres);
+	z_.reserve(numberOfSpheres);
+}
+
+template<typename CoordinatePrimitive>
+CoordinatePrimitive Shapes::SphereCloud<CoordinatePrimitive>::radius() const
+{
+	return radius_;
+}
+
+template<typename CoordinatePrimitive>
+int Shapes::SphereCloud<CoordinatePrimitive>::numberOfSpheres() const
+{
+	return x_.size();
+}
+
+template<typename CoordinatePrimitive>
+MathTypes::Vector<3, CoordinatePrimitive> Shapes::SphereCloud<CoordinatePrimitive>::centre(int sphereIndex) const
+{
+	return MathTypes::Vector<3, CoordinatePrimitive>(x_[sphereIndex], y_[sphereIndex], z_[sphereIndex]);
+}
+
+template<typename CoordinatePrimitive>
+const std::vector<CoordinatePrimitive>& Shapes::SphereCloud<CoordinatePrimitive>::xCoordinates() const
+{
+	return x_;
+}
+
+template<typename CoordinatePrimitive>
+const std::vector<CoordinatePrimitive>& Shapes::SphereCloud<CoordinatePrimitive>::yCoordinates() const
+{
+	return y_;
+}
+
+template<typename CoordinatePrimitive>
+const std::vector<CoordinatePrimitive>& Shapes::SphereCloud<CoordinatePrimitive>::zCoordinates() const
+{
+	return z_;
+}
+
+template<typename CoordinatePrimitive>
+void Shapes::SphereCloud<CoordinatePrimitive>::reorder(const std::vector<int>& newOrder)
+{
+	assert(static_cast<int>(newOrder.size()) == numberOfSpheres());
+
+	auto reorderCoordinates = [&](std::vector<CoordinatePrimitive>& coordinates)
+	{
+		std::vector<CoordinatePrimitive> reorderedCoordinates(coordinates.size());
+		for(int i = 0; i < static_cast<int>(coordinates.size()); i++)
+		{
+			reorderedCoordinates[newOrder[i]] = coordinates[i];
+		}
+		coordinates.swap(reorderedCoordinates);
+	};
+	reorderCoordinates(x_);
+	reorderCoordinates(y_);
+	reorderCoordinates(z_);
+}
+
+template<typename CoordinatePrimitive>
+void Shapes::SphereCloud<CoordinatePrimitive>::transform(
+	const MathTypes::Matrix<4, 4, CoordinatePrimitive>& transformationMatrix)
+{
+	LinearMath::transformPoints(transformationMatrix, x_.data(), y_.data(), z_.data(), numberOfSpheres());
+
+	auto transformedXAxis = MathTypes::Vector<3, CoordinatePrimitive>(
+		transformationMatrix[0][0], transformationMatrix[1][0], transformationMatrix[2][0]);
+	radius_ = radius_ * transformedXAxis.magnitude();
+}
\ No newline at end of file